@@ -16,6 +16,7 @@
 #include <vector>
 #include <set>
 #include <algorithm>
+#include <functional>
 
 #include "Types.h"
 #include "Keywords.h"
@@ -29,9 +30,126 @@ namespace tk {
 const uint8_t UnkEqComp = 0;
 const uint8_t EqCompUnk = 1;
 
+template< uint8_t Layout > class Data;
+
+//! \brief Base of expression templates over Data objects
+//! \details Arithmetic on Data objects does not compute its result right away
+//!   but returns a lightweight expression object that only references its
+//!   operands. The expression is evaluated item by item in a single loop once
+//!   it is assigned (or compound-assigned) to a Data object, which avoids
+//!   allocating, filling, and re-reading full-size temporaries. Uses the
+//!   curiously recurring template pattern: E is the derived expression type.
+//! \tparam Layout Data layout of all operands in the expression
+//! \tparam E Derived expression type
+template< uint8_t Layout, class E >
+struct DataExpr {
+  //! Downcast to the derived expression type
+  //! \return Reference to derived expression
+  const E& self() const { return static_cast< const E& >( *this ); }
+};
+
+//! Type by which an operand is held by an expression: Data objects are held
+//! by reference, expressions (which are cheap to copy) by value
+template< class E >
+struct DataExprOperand { using type = const E; };
+
+//! Data objects are held by const reference in an expression
+template< uint8_t Layout >
+struct DataExprOperand< Data< Layout > > { using type = const Data< Layout >&; };
+
+//! Scalar operand in an expression on Data objects
+template< uint8_t Layout >
+struct DataScalar : DataExpr< Layout, DataScalar< Layout > > {
+  tk::real s;   //!< Scalar value
+  //! Constructor
+  //! \param[in] v Scalar value
+  explicit DataScalar( tk::real v ) : s( v ) {}
+  //! Evaluate expression at a position in the underlying raw data
+  //! \return Scalar value independent of position
+  tk::real elem( std::size_t ) const { return s; }
+};
+
+//! Binary operation in an expression on Data objects
+//! \details An expression only references the Data objects it operates on,
+//!   thus it is only valid until the end of the full expression it is created
+//!   in: it dangles if an operand is a temporary, and yields different values
+//!   if an operand is modified before it is evaluated. To prevent storing an
+//!   expression, e.g., auto x = a - b, its copy and move constructors are
+//!   private and only accessible to the operators creating expressions and to
+//!   enclosing expressions. Assign the result to a Data object instead, e.g.,
+//!   tk::Data< Layout > x = a - b, which evaluates it.
+//! \tparam Layout Data layout of all operands in the expression
+//! \tparam Op Binary function object applied item by item
+//! \tparam A Type of left operand
+//! \tparam B Type of right operand
+template< uint8_t Layout, class Op, class A, class B >
+class DataBinary : public DataExpr< Layout, DataBinary< Layout, Op, A, B > > {
+
+  public:
+    //! Constructor
+    //! \param[in] a Left operand
+    //! \param[in] b Right operand
+    //! \param[in] nu Number of unknowns of the result
+    //! \param[in] np Number of properties of the result
+    explicit DataBinary( const A& a, const B& b, std::size_t nu, std::size_t np )
+      : m_a( a ), m_b( b ), m_nunk( nu ), m_nprop( np ) {}
+
+    //! Evaluate expression at a position in the underlying raw data
+    //! \param[in] i Position in the underlying raw data
+    //! \return Value of the expression at position i
+    tk::real elem( std::size_t i ) const
+    { return Op()( m_a.elem(i), m_b.elem(i) ); }
+
+    //! Number of unknowns accessor
+    //! \return Number of unknowns of the result
+    std::size_t nunk() const noexcept { return m_nunk; }
+
+    //! Number of properties accessor
+    //! \return Number of properties of the result
+    std::size_t nprop() const noexcept { return m_nprop; }
+
+  private:
+    //! Enclosing expressions hold this expression by value
+    template< uint8_t, class, class, class > friend class DataBinary;
+
+    //! Operators creating expressions return them by value
+    template< uint8_t L, class X, class Y >
+    friend DataBinary< L, std::minus< tk::real >, X, Y >
+    operator- ( const DataExpr< L, X >&, const DataExpr< L, Y >& );
+    template< uint8_t L, class X, class Y >
+    friend DataBinary< L, std::plus< tk::real >, X, Y >
+    operator+ ( const DataExpr< L, X >&, const DataExpr< L, Y >& );
+    template< uint8_t L, class X, class Y >
+    friend DataBinary< L, std::multiplies< tk::real >, X, Y >
+    operator* ( const DataExpr< L, X >&, const DataExpr< L, Y >& );
+    template< uint8_t L, class X, class Y >
+    friend DataBinary< L, std::divides< tk::real >, X, Y >
+    operator/ ( const DataExpr< L, X >&, const DataExpr< L, Y >& );
+    template< uint8_t L, class X >
+    friend DataBinary< L, std::multiplies< tk::real >, X, DataScalar< L > >
+    operator* ( const DataExpr< L, X >&, tk::real );
+    template< uint8_t L, class X >
+    friend DataBinary< L, std::multiplies< tk::real >, DataScalar< L >, X >
+    operator* ( tk::real, const DataExpr< L, X >& );
+
+    //! Copy constructor: private to prevent storing expressions
+    DataBinary( const DataBinary& ) = default;
+    //! Move constructor: private to prevent storing expressions
+    DataBinary( DataBinary&& ) = default;
+    //! Don't permit copy assigment
+    DataBinary& operator=( const DataBinary& ) = delete;
+    //! Don't permit move assigment
+    DataBinary& operator=( DataBinary&& ) = delete;
+
+    typename DataExprOperand< A >::type m_a;    //!< Left operand
+    typename DataExprOperand< B >::type m_b;    //!< Right operand
+    std::size_t m_nunk;                         //!< Number of unknowns
+    std::size_t m_nprop;                        //!< Number of properties
+};
+
 //! Zero-runtime-cost data-layout wrappers with type-based compile-time dispatch
 template< uint8_t Layout >
-class Data {
+class Data : public DataExpr< Layout, Data< Layout > > {
 
   private:
     //! \brief Inherit type of number of components from keyword 'ncomp', used
@@ -51,6 +169,33 @@ class Data {
       m_nunk( nu ),
       m_nprop( np ) {}
 
+    //! Constructor evaluating an expression on Data objects
+    //! \param[in] e Expression to evaluate into the newly constructed object
+    template< class E >
+    Data( const DataExpr< Layout, E >& e ) :
+      m_vec( e.self().nunk() * e.self().nprop() ),
+      m_nunk( e.self().nunk() ),
+      m_nprop( e.self().nprop() )
+    {
+      const auto& x = e.self();
+      for (std::size_t i=0; i<m_vec.size(); ++i) m_vec[i] = x.elem(i);
+    }
+
+    //! Assignment evaluating an expression on Data objects
+    //! \param[in] e Expression to evaluate into this object
+    //! \return Reference to ourselves after assignment
+    //! \details Since expressions are evaluated item by item, the expression
+    //!   may reference this object, e.g., u = u + dt*r.
+    template< class E >
+    Data< Layout >& operator= ( const DataExpr< Layout, E >& e ) {
+      const auto& x = e.self();
+      m_vec.resize( x.nunk() * x.nprop() );
+      m_nunk = x.nunk();
+      m_nprop = x.nprop();
+      for (std::size_t i=0; i<m_vec.size(); ++i) m_vec[i] = x.elem(i);
+      return *this;
+    }
+
     //! Const data access dispatch
     //! \details Public interface to const-ref data access to a single real
     //!   value. Use it as Data(p,c,o), where p is the unknown index, c is
@@ -269,6 +414,12 @@ class Data {
     //! \return Non-constant reference to underlying raw data
     std::vector< tk::real >& data() { return m_vec; }
 
+    //! Evaluate at a position in the underlying raw data
+    //! \param[in] i Position in the underlying raw data
+    //! \return Value at position i
+    //! \details This is the item accessor used by expressions on Data objects
+    tk::real elem( std::size_t i ) const { return m_vec[i]; }
+
     //! Compound operator-=
     //! \param[in] rhs Data object to subtract
     //! \return Reference to ourselves after subtraction
@@ -280,12 +431,17 @@ class Data {
                       []( tk::real s, tk::real d ){ return d-s; } );
       return *this;
     }
-    //! Operator -
-    //! \param[in] rhs Data object to subtract
-    //! \return Copy of Data object after rhs has been subtracted
-    //! \details Implemented in terms of compound operator-=
-    Data< Layout > operator- ( const Data< Layout >& rhs )
-    const { return Data< Layout >( *this ) -= rhs; }
+    //! Compound operator-= subtracting an expression on Data objects
+    //! \param[in] rhs Expression to subtract
+    //! \return Reference to ourselves after subtraction
+    template< class E >
+    Data< Layout >& operator-= ( const DataExpr< Layout, E >& rhs ) {
+      const auto& x = rhs.self();
+      Assert( x.nunk() == m_nunk, "Incorrect number of unknowns" );
+      Assert( x.nprop() == m_nprop, "Incorrect number of properties" );
+      for (std::size_t i=0; i<m_vec.size(); ++i) m_vec[i] -= x.elem(i);
+      return *this;
+    }
 
     //! Compound operator+=
     //! \param[in] rhs Data object to add
@@ -298,12 +454,17 @@ class Data {
                       []( tk::real s, tk::real d ){ return d+s; } );
       return *this;
     }
-    //! Operator +
-    //! \param[in] rhs Data object to add
-    //! \return Copy of Data object after rhs has been multiplied with
-    //! \details Implemented in terms of compound operator+=
-    Data< Layout > operator+ ( const Data< Layout >& rhs )
-    const { return Data< Layout >( *this ) += rhs; }
+    //! Compound operator+= adding an expression on Data objects
+    //! \param[in] rhs Expression to add
+    //! \return Reference to ourselves after addition
+    template< class E >
+    Data< Layout >& operator+= ( const DataExpr< Layout, E >& rhs ) {
+      const auto& x = rhs.self();
+      Assert( x.nunk() == m_nunk, "Incorrect number of unknowns" );
+      Assert( x.nprop() == m_nprop, "Incorrect number of properties" );
+      for (std::size_t i=0; i<m_vec.size(); ++i) m_vec[i] += x.elem(i);
+      return *this;
+    }
 
     //! Compound operator*= multiplying by another Data object item by item
     //! \param[in] rhs Data object to multiply with
@@ -316,12 +477,6 @@ class Data {
                       []( tk::real s, tk::real d ){ return d*s; } );
       return *this;
     }
-    //! Operator * multiplying by another Data object item by item
-    //! \param[in] rhs Data object to multiply with
-    //! \return Copy of Data object after rhs has been multiplied with
-    //! \details Implemented in terms of compound operator*=
-    Data< Layout > operator* ( const Data< Layout >& rhs )
-    const { return Data< Layout >( *this ) *= rhs; }
 
     //! Compound operator*= multiplying all items by a scalar
     //! \param[in] rhs Scalar to multiply with
@@ -330,12 +485,6 @@ class Data {
       for (auto& v : m_vec) v *= rhs;
       return *this;
     }
-    //! Operator * multiplying all items by a scalar
-    //! \param[in] rhs Scalar to multiply with
-    //! \return Copy of Data object after rhs has been multiplied with
-    //! \details Implemented in terms of compound operator*=
-    Data< Layout > operator* ( tk::real rhs )
-    const { return Data< Layout >( *this ) *= rhs; }
 
     //! Compound operator/=
     //! \param[in] rhs Data object to divide by
@@ -348,12 +497,6 @@ class Data {
                       []( tk::real s, tk::real d ){ return d/s; } );
       return *this;
     }
-    //! Operator /
-    //! \param[in] rhs Data object to divide by
-    //! \return Copy of Data object after rhs has been divided by
-    //! \details Implemented in terms of compound operator/=
-    Data< Layout > operator/ ( const Data< Layout >& rhs )
-    const { return Data< Layout >( *this ) /= rhs; }
 
     //! Add new unknown at the end of the container
     //! \param[in] prop Vector of properties to initialize the new unknown with
@@ -546,13 +689,82 @@ class Data {
     ncomp_t m_nprop;                    //!< Number of properties/unknown
 };
 
+//! Operator - between two Data objects or expressions
+//! \param[in] a Expression to subtract from
+//! \param[in] b Expression to subtract
+//! \return Expression evaluating a-b item by item when assigned
+template< uint8_t Layout, class A, class B >
+DataBinary< Layout, std::minus< tk::real >, A, B >
+operator- ( const DataExpr< Layout, A >& a, const DataExpr< Layout, B >& b ) {
+  Assert( a.self().nunk() == b.self().nunk(), "Number of unknowns unequal" );
+  Assert( a.self().nprop() == b.self().nprop(), "Number of properties unequal" );
+  return DataBinary< Layout, std::minus< tk::real >, A, B >
+           ( a.self(), b.self(), a.self().nunk(), a.self().nprop() );
+}
+
+//! Operator + between two Data objects or expressions
+//! \param[in] a Expression to add
+//! \param[in] b Expression to add
+//! \return Expression evaluating a+b item by item when assigned
+template< uint8_t Layout, class A, class B >
+DataBinary< Layout, std::plus< tk::real >, A, B >
+operator+ ( const DataExpr< Layout, A >& a, const DataExpr< Layout, B >& b ) {
+  Assert( a.self().nunk() == b.self().nunk(), "Number of unknowns unequal" );
+  Assert( a.self().nprop() == b.self().nprop(), "Number of properties unequal" );
+  return DataBinary< Layout, std::plus< tk::real >, A, B >
+           ( a.self(), b.self(), a.self().nunk(), a.self().nprop() );
+}
+
+//! Operator * between two Data objects or expressions multiplying item by item
+//! \param[in] a Expression to multiply
+//! \param[in] b Expression to multiply with
+//! \return Expression evaluating a*b item by item when assigned
+template< uint8_t Layout, class A, class B >
+DataBinary< Layout, std::multiplies< tk::real >, A, B >
+operator* ( const DataExpr< Layout, A >& a, const DataExpr< Layout, B >& b ) {
+  Assert( a.self().nunk() == b.self().nunk(), "Number of unknowns unequal" );
+  Assert( a.self().nprop() == b.self().nprop(), "Number of properties unequal" );
+  return DataBinary< Layout, std::multiplies< tk::real >, A, B >
+           ( a.self(), b.self(), a.self().nunk(), a.self().nprop() );
+}
+
+//! Operator / between two Data objects or expressions dividing item by item
+//! \param[in] a Expression to divide
+//! \param[in] b Expression to divide by
+//! \return Expression evaluating a/b item by item when assigned
+template< uint8_t Layout, class A, class B >
+DataBinary< Layout, std::divides< tk::real >, A, B >
+operator/ ( const DataExpr< Layout, A >& a, const DataExpr< Layout, B >& b ) {
+  Assert( a.self().nunk() == b.self().nunk(), "Number of unknowns unequal" );
+  Assert( a.self().nprop() == b.self().nprop(), "Number of properties unequal" );
+  return DataBinary< Layout, std::divides< tk::real >, A, B >
+           ( a.self(), b.self(), a.self().nunk(), a.self().nprop() );
+}
+
+//! Operator * multiplying all items by a scalar from the right
+//! \param[in] a Data object or expression to multiply
+//! \param[in] s Scalar to multiply with
+//! \return Expression evaluating a*s item by item when assigned
+template< uint8_t Layout, class A >
+DataBinary< Layout, std::multiplies< tk::real >, A, DataScalar< Layout > >
+operator* ( const DataExpr< Layout, A >& a, tk::real s ) {
+  return DataBinary< Layout, std::multiplies< tk::real >, A,
+                     DataScalar< Layout > >
+           ( a.self(), DataScalar< Layout >( s ), a.self().nunk(),
+             a.self().nprop() );
+}
+
 //! Operator * multiplying all items by a scalar from the left
-//! \param[in] lhs Scalar to multiply with
-//! \param[in] rhs Date object to multiply
-//! \return New Data object with all items multipled with lhs
-template< uint8_t Layout >
-Data< Layout > operator* ( tk::real lhs, const Data< Layout >& rhs ) {
-  return Data< Layout >( rhs ) *= lhs;
+//! \param[in] s Scalar to multiply with
+//! \param[in] a Data object or expression to multiply
+//! \return Expression evaluating s*a item by item when assigned
+template< uint8_t Layout, class A >
+DataBinary< Layout, std::multiplies< tk::real >, DataScalar< Layout >, A >
+operator* ( tk::real s, const DataExpr< Layout, A >& a ) {
+  return DataBinary< Layout, std::multiplies< tk::real >,
+                     DataScalar< Layout >, A >
+           ( DataScalar< Layout >( s ), a.self(), a.self().nunk(),
+             a.self().nprop() );
 }
 
 //! Operator min between two Data objects
@@ -624,7 +836,7 @@ bool operator!= ( const Data< Layout >& lhs, const Data< Layout >& rhs )
 
 //! Compute the maximum difference between the elements of two Data objects
 //! \param[in] lhs 1st Data object
-//! \param[in] rhs 2nd Data object
+//! \param[in] rhs 2nd Data object or expression on Data objects
 //! \return The index, i.e., the raw position, of and the largest absolute value
 //!   of the difference between all corresponding elements of _lhs_ and _rhs_.
 //! \details The position returned is the position in the underlying raw data
@@ -633,19 +845,17 @@ bool operator!= ( const Data< Layout >& lhs, const Data< Layout >& rhs )
 //!   is returned.
 //! \note The Data objects _lhs_ and _rhs_ must have the same number of
 //!   unknowns and properties.
-template< uint8_t Layout >
+template< uint8_t Layout, class E >
 std::pair< std::size_t, tk::real >
-maxdiff( const Data< Layout >& lhs, const Data< Layout >& rhs ) {
-  Assert( lhs.nunk() == rhs.nunk(), "Number of unknowns unequal" );
-  Assert( lhs.nprop() == rhs.nprop(), "Number of properties unequal" );
-  auto l = lhs.data().cbegin();
-  auto r = rhs.data().cbegin();
-  std::pair< std::size_t, tk::real > m( 0, std::abs(*l - *r) );
-  ++l; ++r;
-  while (l != lhs.data().cend()) {
-    const auto d = std::abs(*l - *r);
-    if (d > m.second) m = { std::distance(lhs.data().cbegin(),l), d };
-    ++l; ++r;
+maxdiff( const Data< Layout >& lhs, const DataExpr< Layout, E >& rhs ) {
+  const auto& r = rhs.self();
+  Assert( lhs.nunk() == r.nunk(), "Number of unknowns unequal" );
+  Assert( lhs.nprop() == r.nprop(), "Number of properties unequal" );
+  const auto& l = lhs.data();
+  std::pair< std::size_t, tk::real > m( 0, std::abs(l[0] - r.elem(0)) );
+  for (std::size_t i=1; i<l.size(); ++i) {
+    const auto d = std::abs(l[i] - r.elem(i));
+    if (d > m.second) m = { i, d };
   }
   return m;
 }
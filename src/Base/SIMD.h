@@ -0,0 +1,197 @@
+// *****************************************************************************
+/*!
+  \file      src/Base/SIMD.h
+  \copyright 2016-2018, Los Alamos National Security, LLC.
+  \brief     Thin wrapper over SIMD intrinsics for kernels over packs of reals
+  \details   Thin wrapper over SIMD intrinsics for kernels over packs of reals.
+    A kernel written as a function template of the value type V can be
+    instantiated both with V = tk::simd::pack, operating on
+    tk::simd::width< pack >::value consecutive reals at a time, and with V =
+    tk::real, operating on a single real, e.g., to process the remainder of a
+    loop. The pack uses AVX if enabled by the compiler, SSE2 otherwise, and
+    falls back to tk::real if neither is available.
+
+    All pack operations are IEEE correctly rounded lane-wise, so that a pack
+    kernel yields bitwise identical results to its scalar instantiation,
+    provided the compiler does not contract floating-point expressions and the
+    operands of min() and max() are not NaN.
+*/
+// *****************************************************************************
+#ifndef SIMD_h
+#define SIMD_h
+
+#include <cmath>
+#include <cstddef>
+
+#if defined(__AVX__) || defined(__SSE2__)
+  #include <immintrin.h>
+#endif
+
+#include "Types.h"
+
+namespace tk {
+namespace simd {
+
+//! Number of reals processed at a time by value type V
+template< class V > struct width;
+
+//! A single real is processed at a time by tk::real
+template<> struct width< tk::real > {
+  static constexpr std::size_t value = 1;
+};
+
+//! Load value type V from consecutive reals
+template< class V > inline V load( const tk::real* p );
+
+//! Load a single real
+//! \param[in] p Address to load from
+//! \return Real at p
+template<> inline tk::real load< tk::real >( const tk::real* p ) { return *p; }
+
+//! Store a single real
+//! \param[in] p Address to store to
+//! \param[in] a Real to store
+inline void store( tk::real* p, tk::real a ) { *p = a; }
+
+//! Square root of a single real
+inline tk::real sqrt( tk::real a ) { return std::sqrt( a ); }
+
+//! Minimum of two reals
+inline tk::real min( tk::real a, tk::real b ) { return std::fmin( a, b ); }
+
+//! Maximum of two reals
+inline tk::real max( tk::real a, tk::real b ) { return std::fmax( a, b ); }
+
+//! Absolute value of a single real
+inline tk::real abs( tk::real a ) { return std::fabs( a ); }
+
+//! Select between two reals
+//! \param[in] m Condition
+//! \param[in] a Real returned if m is true
+//! \param[in] b Real returned if m is false
+//! \return m ? a : b
+inline tk::real select( bool m, tk::real a, tk::real b ) { return m ? a : b; }
+
+#if defined(__AVX__)
+
+//! Pack of reals processed by single instructions
+struct pack { __m256d v; };
+
+//! Lane-wise result of comparing two packs
+struct mask { __m256d v; };
+
+//! Four reals are processed at a time by a pack
+template<> struct width< pack > { static constexpr std::size_t value = 4; };
+
+//! Load a pack
+//! \param[in] p Address of the first real to load
+//! \return Pack of consecutive reals starting at p
+template<> inline pack load< pack >( const tk::real* p )
+{ return { _mm256_loadu_pd( p ) }; }
+
+//! Store a pack
+//! \param[in] p Address to store the first real to
+//! \param[in] a Pack to store
+inline void store( tk::real* p, pack a ) { _mm256_storeu_pd( p, a.v ); }
+
+//! Broadcast a real to all lanes of a pack
+inline pack broadcast( tk::real a ) { return { _mm256_set1_pd( a ) }; }
+
+inline pack operator+( pack a, pack b ) { return { _mm256_add_pd(a.v,b.v) }; }
+inline pack operator-( pack a, pack b ) { return { _mm256_sub_pd(a.v,b.v) }; }
+inline pack operator*( pack a, pack b ) { return { _mm256_mul_pd(a.v,b.v) }; }
+inline pack operator/( pack a, pack b ) { return { _mm256_div_pd(a.v,b.v) }; }
+
+inline mask operator>( pack a, pack b )
+{ return { _mm256_cmp_pd( a.v, b.v, _CMP_GT_OQ ) }; }
+inline mask operator>=( pack a, pack b )
+{ return { _mm256_cmp_pd( a.v, b.v, _CMP_GE_OQ ) }; }
+
+inline pack sqrt( pack a ) { return { _mm256_sqrt_pd( a.v ) }; }
+inline pack min( pack a, pack b ) { return { _mm256_min_pd( a.v, b.v ) }; }
+inline pack max( pack a, pack b ) { return { _mm256_max_pd( a.v, b.v ) }; }
+inline pack abs( pack a )
+{ return { _mm256_andnot_pd( _mm256_set1_pd( -0.0 ), a.v ) }; }
+
+//! Select lane-wise between two packs
+//! \param[in] m Condition
+//! \param[in] a Pack whose lanes are returned where m is true
+//! \param[in] b Pack whose lanes are returned where m is false
+//! \return m ? a : b lane-wise
+inline pack select( mask m, pack a, pack b )
+{ return { _mm256_blendv_pd( b.v, a.v, m.v ) }; }
+
+#elif defined(__SSE2__)
+
+//! Pack of reals processed by single instructions
+struct pack { __m128d v; };
+
+//! Lane-wise result of comparing two packs
+struct mask { __m128d v; };
+
+//! Two reals are processed at a time by a pack
+template<> struct width< pack > { static constexpr std::size_t value = 2; };
+
+//! Load a pack
+//! \param[in] p Address of the first real to load
+//! \return Pack of consecutive reals starting at p
+template<> inline pack load< pack >( const tk::real* p )
+{ return { _mm_loadu_pd( p ) }; }
+
+//! Store a pack
+//! \param[in] p Address to store the first real to
+//! \param[in] a Pack to store
+inline void store( tk::real* p, pack a ) { _mm_storeu_pd( p, a.v ); }
+
+//! Broadcast a real to all lanes of a pack
+inline pack broadcast( tk::real a ) { return { _mm_set1_pd( a ) }; }
+
+inline pack operator+( pack a, pack b ) { return { _mm_add_pd( a.v, b.v ) }; }
+inline pack operator-( pack a, pack b ) { return { _mm_sub_pd( a.v, b.v ) }; }
+inline pack operator*( pack a, pack b ) { return { _mm_mul_pd( a.v, b.v ) }; }
+inline pack operator/( pack a, pack b ) { return { _mm_div_pd( a.v, b.v ) }; }
+
+inline mask operator>( pack a, pack b ) { return { _mm_cmpgt_pd(a.v,b.v) }; }
+inline mask operator>=( pack a, pack b ) { return { _mm_cmpge_pd(a.v,b.v) }; }
+
+inline pack sqrt( pack a ) { return { _mm_sqrt_pd( a.v ) }; }
+inline pack min( pack a, pack b ) { return { _mm_min_pd( a.v, b.v ) }; }
+inline pack max( pack a, pack b ) { return { _mm_max_pd( a.v, b.v ) }; }
+inline pack abs( pack a )
+{ return { _mm_andnot_pd( _mm_set1_pd( -0.0 ), a.v ) }; }
+
+//! Select lane-wise between two packs
+//! \param[in] m Condition
+//! \param[in] a Pack whose lanes are returned where m is true
+//! \param[in] b Pack whose lanes are returned where m is false
+//! \return m ? a : b lane-wise
+inline pack select( mask m, pack a, pack b )
+{ return { _mm_or_pd( _mm_and_pd( m.v, a.v ), _mm_andnot_pd( m.v, b.v ) ) }; }
+
+#else
+
+//! Without SIMD support a pack is a single real
+using pack = tk::real;
+
+#endif
+
+#if defined(__AVX__) || defined(__SSE2__)
+
+inline pack operator+( tk::real a, pack b ) { return broadcast(a) + b; }
+inline pack operator-( tk::real a, pack b ) { return broadcast(a) - b; }
+inline pack operator*( tk::real a, pack b ) { return broadcast(a) * b; }
+inline pack operator/( tk::real a, pack b ) { return broadcast(a) / b; }
+inline pack operator+( pack a, tk::real b ) { return a + broadcast(b); }
+inline pack operator-( pack a, tk::real b ) { return a - broadcast(b); }
+inline pack operator*( pack a, tk::real b ) { return a * broadcast(b); }
+inline pack operator/( pack a, tk::real b ) { return a / broadcast(b); }
+
+inline mask operator>( pack a, tk::real b ) { return a > broadcast(b); }
+inline mask operator>=( pack a, tk::real b ) { return a >= broadcast(b); }
+
+#endif
+
+} // simd::
+} // tk::
+
+#endif // SIMD_h
@@ -90,6 +90,7 @@ namespace grm {
     NORNG,              //!< No RNG selected
     NODT,               //!< No time-step-size policy selected
     MULDT,              //!< Multiple time-step-size policies selected
+    PRECOND,            //!< Preconditioner unsupported by linear solver
     NOSAMPLES,          //!< PDF need a variable
     INVALIDSAMPLESPACE, //!< PDF sample space specification incorrect
     MALFORMEDSAMPLE,    //!< PDF sample space variable specification incorrect
@@ -163,6 +164,9 @@ namespace grm {
       "constant or 'cfl' to set an adaptive time step size calculation policy. "
       "Setting 'cfl' and 'dt' are mutually exclusive. If both 'cfl' and 'dt' "
       "are set, 'dt' wins." },
+    { MsgKey::PRECOND, "The preconditioner selected in the preceding block is "
+      "not supported by the linear solver selected. Preconditioners 'amg' and "
+      "'parasails' are only available with the linear solver 'hypre'." },
     { MsgKey::NOINIT, "No initialization policy has been specified within the "
       "block preceding this position. This is mandatory for the preceding "
       "block. Use the keyword 'init' to specify an initialization policy." },
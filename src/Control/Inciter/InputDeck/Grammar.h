@@ -34,7 +34,8 @@ namespace deck {
                             ctr::InputDeck::keywords3,
                             ctr::InputDeck::keywords4,
                             ctr::InputDeck::keywords5,
-                            ctr::InputDeck::keywords6 >;
+                            ctr::InputDeck::keywords6,
+                            ctr::InputDeck::keywords7 >;
 
   // Inciter's InputDeck state
 
@@ -260,6 +261,25 @@ namespace grm {
     }
   };
 
+  //! Rule used to trigger action
+  struct check_linsolver : pegtl::success {};
+  //! \brief Do error checking on the linear solver configuration
+  template<> struct action< check_linsolver > {
+    template< typename Input, typename Stack >
+    static void apply( const Input& in, Stack& stack ) {
+      using tk::ctr::LinearSolverType;
+      using tk::ctr::PreconditionerType;
+      // Error out if a Hypre-only preconditioner is used with a native solver
+      const auto& ls = stack.template get< tag::selected, tag::linsolver >();
+      const auto& pc =
+        stack.template get< tag::selected, tag::preconditioner >();
+      if (ls != LinearSolverType::HYPRE &&
+          (pc == PreconditionerType::AMG ||
+           pc == PreconditionerType::PARASAILS))
+        Message< Stack, ERROR, MsgKey::PRECOND >( stack, in );
+    }
+  };
+
   //! Rule used to trigger action
   struct enable_amr : pegtl::success {};
   //! Enable adaptive mesh refinement (AMR)
@@ -322,9 +342,21 @@ namespace deck {
            tk::grm::process< use< kw::fct >, 
                              tk::grm::Store< tag::discr, tag::fct >,
                              pegtl::alpha >,
+           tk::grm::process< use< kw::fused_rhs >,
+                             tk::grm::Store< tag::discr, tag::fusedrhs >,
+                             pegtl::alpha >,
+           tk::grm::process< use< kw::local_reorder >,
+                             tk::grm::Store< tag::discr, tag::localreorder >,
+                             pegtl::alpha >,
+           tk::grm::process< use< kw::aggregate >,
+                             tk::grm::Store< tag::discr, tag::aggregate >,
+                             pegtl::alpha >,
            tk::grm::interval< kw::ttyi, tag::tty >,
+           tk::grm::interval< kw::lbfreq, tag::lb >,
            discroption< use, kw::scheme, inciter::ctr::Scheme, tag::scheme >,
-           discroption< use, kw::flux, inciter::ctr::Flux, tag::flux >
+           discroption< use, kw::flux, inciter::ctr::Flux, tag::flux >,
+           discroption< use, kw::time_integration,
+                        inciter::ctr::TimeIntegration, tag::timeint >
          > {};
 
   //! PDE parameter vector
@@ -480,6 +512,39 @@ namespace deck {
                                tag::partitioner >,
                              pegtl::alpha > > > {};
 
+  //! linsolver ... end block
+  struct linsolver :
+         pegtl::if_must<
+           tk::grm::readkw< use< kw::linsolver >::pegtl_string >,
+           tk::grm::block< use< kw::end >,
+                           tk::grm::process<
+                             use< kw::solver >,
+                             tk::grm::store_inciter_option<
+                               tk::ctr::LinearSolver,
+                               tag::selected,
+                               tag::linsolver >,
+                             pegtl::alpha >,
+                           tk::grm::process<
+                             use< kw::preconditioner >,
+                             tk::grm::store_inciter_option<
+                               tk::ctr::Preconditioner,
+                               tag::selected,
+                               tag::preconditioner >,
+                             pegtl::alnum >,
+                           tk::grm::process<
+                             use< kw::linsolver_tol >,
+                             tk::grm::Store< tag::discr, tag::lintol >,
+                             pegtl::digit >,
+                           tk::grm::process<
+                             use< kw::linsolver_maxit >,
+                             tk::grm::Store< tag::discr, tag::linmaxit >,
+                             pegtl::digit >,
+                           tk::grm::process<
+                             use< kw::linsolver_stats >,
+                             tk::grm::Store< tag::discr, tag::linstats >,
+                             pegtl::alpha > >,
+           tk::grm::check_linsolver > {};
+
   //! equation types
   struct equations :
          pegtl::sor< transport, compflow > {};
@@ -519,6 +584,10 @@ namespace deck {
                                                tag::selected,
                                                tag::filetype >,
                                              pegtl::alpha >,
+                           tk::grm::process< use< kw::nwriter >,
+                                             tk::grm::Store< tag::discr,
+                                                             tag::nwriter >,
+                                             pegtl::digit >,
                            tk::grm::interval< use< kw::interval >,
                                               tag::field > > > {};
 
@@ -533,6 +602,7 @@ namespace deck {
                            equations,
                            amr,
                            partitioning,
+                           linsolver,
                            plotvar,
                            tk::grm::diagnostics<
                              use,
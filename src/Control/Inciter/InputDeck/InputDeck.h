@@ -71,6 +71,7 @@ class InputDeck :
                                        kw::rib,
                                        kw::hsfc,
                                        kw::phg,
+                                       kw::graph,
                                        kw::inciter >;
     using keywords2 = boost::mpl::set< kw::ncomp,
                                        kw::pde_diffusivity,
@@ -134,7 +135,9 @@ class InputDeck :
                                        kw::scheme,
                                        kw::matcg,
                                        kw::diagcg,
-                                       kw::dg >;
+                                       kw::dg,
+                                       kw::fused_rhs,
+                                       kw::local_reorder >;
     using keywords6 = boost::mpl::set< kw::flux,
                                        kw::laxfriedrichs,
                                        kw::hllc,
@@ -143,7 +146,28 @@ class InputDeck :
                                        kw::bc_outlet,
                                        kw::bc_extrapolate,
                                        kw::gauss_hump,
-                                       kw::sod_shocktube >;
+                                       kw::sod_shocktube,
+                                       kw::time_integration,
+                                       kw::fwd_euler,
+                                       kw::ssprk2,
+                                       kw::ssprk3,
+                                       kw::lbfreq,
+                                       kw::aggregate >;
+    using keywords7 = boost::mpl::set< kw::linsolver,
+                                       kw::solver,
+                                       kw::hypre,
+                                       kw::cg,
+                                       kw::gmres,
+                                       kw::preconditioner,
+                                       kw::pc_none,
+                                       kw::jacobi,
+                                       kw::ilu0,
+                                       kw::amg,
+                                       kw::parasails,
+                                       kw::linsolver_tol,
+                                       kw::linsolver_maxit,
+                                       kw::linsolver_stats,
+                                       kw::nwriter >;
 
     //! \brief Constructor: set defaults
     //! \param[in] cl Previously parsed and store command line
@@ -162,10 +186,22 @@ class InputDeck :
       set< tag::discr, tag::cfl >( 0.0 );
       set< tag::discr, tag::fct >( true );
       set< tag::discr, tag::ctau >( 1.0 );
+      set< tag::discr, tag::fusedrhs >( false );
+      set< tag::discr, tag::localreorder >( false );
+      set< tag::discr, tag::aggregate >( false );
+      set< tag::discr, tag::linstats >( false );
+      set< tag::discr, tag::lintol >( 1.0e-14 );
+      set< tag::discr, tag::linmaxit >( 1000 );
+      set< tag::discr, tag::nwriter >( 0 );
       set< tag::discr, tag::scheme >( SchemeType::MatCG );
       set< tag::discr, tag::flux >( FluxType::HLLC );
+      set< tag::discr, tag::timeint >( TimeIntegrationType::FwdEuler );
       // Default field output file type
       set< tag::selected, tag::filetype >( tk::ctr::FieldFileType::EXODUSII );
+      // Default linear solver settings
+      set< tag::selected, tag::linsolver >( tk::ctr::LinearSolverType::HYPRE );
+      set< tag::selected, tag::preconditioner >
+         ( tk::ctr::PreconditionerType::NONE );
       // Default AMR settings
       set< tag::amr, tag::amr >( false );
       set< tag::amr, tag::levels >( 1 );
@@ -176,6 +212,7 @@ class InputDeck :
       set< tag::interval, tag::tty >( 1 );
       set< tag::interval, tag::field >( 1 );
       set< tag::interval, tag::diag >( 1 );
+      set< tag::interval, tag::lb >( 0 );
       // Initialize help: fill own keywords
       const auto& ctrinfoFill = tk::ctr::Info( get< tag::cmd, tag::ctrinfo >() );
       boost::mpl::for_each< keywords1 >( ctrinfoFill );
@@ -184,6 +221,7 @@ class InputDeck :
       boost::mpl::for_each< keywords4 >( ctrinfoFill );
       boost::mpl::for_each< keywords5 >( ctrinfoFill );
       boost::mpl::for_each< keywords6 >( ctrinfoFill );
+      boost::mpl::for_each< keywords7 >( ctrinfoFill );
     }
 
     /** @name Pack/Unpack: Serialize InputDeck object for Charm++ */
@@ -0,0 +1,72 @@
+// *****************************************************************************
+/*!
+  \file      src/Control/Inciter/Options/TimeIntegration.h
+  \copyright 2016-2018, Los Alamos National Security, LLC.
+  \brief     Time integration options for inciter
+  \details   Time integration options for inciter
+*/
+// *****************************************************************************
+#ifndef TimeIntegrationOptions_h
+#define TimeIntegrationOptions_h
+
+#include <boost/mpl/vector.hpp>
+#include "NoWarning/for_each.h"
+
+#include "Toggle.h"
+#include "Keywords.h"
+#include "PUPUtil.h"
+
+namespace inciter {
+namespace ctr {
+
+//! Time integration types
+enum class TimeIntegrationType : uint8_t { FwdEuler
+                                         , SSPRK2
+                                         , SSPRK3 };
+
+//! Pack/Unpack TimeIntegrationType: forward overload to generic enum class
+//!   packer
+inline void operator|( PUP::er& p, TimeIntegrationType& e )
+{ PUP::pup( p, e ); }
+
+//! \brief Time integration options: outsource to base templated on enum type
+class TimeIntegration : public tk::Toggle< TimeIntegrationType > {
+
+  public:
+    //! Valid expected choices to make them also available at compile-time
+    using keywords = boost::mpl::vector< kw::fwd_euler
+                                       , kw::ssprk2
+                                       , kw::ssprk3
+                                       >;
+
+    //! \brief Options constructor
+    //! \details Simply initialize in-line and pass associations to base, which
+    //!    will handle client interactions
+    explicit TimeIntegration() :
+      tk::Toggle< TimeIntegrationType >(
+        //! Group, i.e., options, name
+        kw::time_integration::name(),
+        //! Enums -> names (if defined, policy codes, if not, name)
+        { { TimeIntegrationType::FwdEuler, kw::fwd_euler::name() },
+          { TimeIntegrationType::SSPRK2, kw::ssprk2::name() },
+          { TimeIntegrationType::SSPRK3, kw::ssprk3::name() } },
+        //! keywords -> Enums
+        { { kw::fwd_euler::string(), TimeIntegrationType::FwdEuler },
+          { kw::ssprk2::string(), TimeIntegrationType::SSPRK2 },
+          { kw::ssprk3::string(), TimeIntegrationType::SSPRK3 } } )
+    {}
+
+    //! Return the number of stages of a time integration scheme
+    //! \param[in] t Time integration type
+    //! \return Number of right-hand side evaluations per time step
+    std::size_t nstage( TimeIntegrationType t ) const {
+      if (t == TimeIntegrationType::SSPRK2) return 2;
+      else if (t == TimeIntegrationType::SSPRK3) return 3;
+      else return 1;
+    }
+};
+
+} // ctr::
+} // inciter::
+
+#endif // TimeIntegrationOptions_h
@@ -19,9 +19,12 @@
 #include "Inciter/Options/Problem.h"
 #include "Inciter/Options/Scheme.h"
 #include "Inciter/Options/Flux.h"
+#include "Inciter/Options/TimeIntegration.h"
 #include "Inciter/Options/AMRInitial.h"
 #include "Inciter/Options/AMRError.h"
 #include "Options/PartitioningAlgorithm.h"
+#include "Options/LinearSolver.h"
+#include "Options/Preconditioner.h"
 #include "Options/TxtFloatFormat.h"
 #include "Options/FieldFile.h"
 #include "Options/Error.h"
@@ -36,6 +39,8 @@ using namespace tao;
 using selects = tk::tuple::tagged_tuple<
   tag::pde,         std::vector< ctr::PDEType >,       //!< Partial diff eqs
   tag::partitioner, tk::ctr::PartitioningAlgorithmType,//!< Mesh partitioner
+  tag::linsolver,   tk::ctr::LinearSolverType,         //!< Linear solver
+  tag::preconditioner, tk::ctr::PreconditionerType,    //!< Preconditioner
   tag::filetype,    tk::ctr::FieldFileType           //!< Field output file type
 >;
 
@@ -56,8 +61,16 @@ using discretization = tk::tuple::tagged_tuple<
   tag::cfl,    kw::cfl::info::expect::type,   //!< CFL coefficient
   tag::fct,    bool,                          //!< FCT on/off
   tag::ctau,   kw::ctau::info::expect::type,  //!< FCT mass diffisivity
+  tag::fusedrhs, bool,                        //!< Single-pass CG rhs on/off
+  tag::localreorder, bool,                    //!< Local mesh renumbering on/off
+  tag::aggregate, bool,                       //!< Message aggregation on/off
+  tag::linstats, bool,                        //!< Linear solver stats on/off
+  tag::lintol, kw::linsolver_tol::info::expect::type, //!< Lin. solver tol.
+  tag::linmaxit, kw::linsolver_maxit::info::expect::type, //!< Lin. max iter
+  tag::nwriter, kw::nwriter::info::expect::type, //!< Field writers
   tag::scheme, inciter::ctr::SchemeType,      //!< Spatial discretization type
-  tag::flux,   inciter::ctr::FluxType         //!< Flux function type
+  tag::flux,   inciter::ctr::FluxType,        //!< Flux function type
+  tag::timeint, inciter::ctr::TimeIntegrationType //!< Time integration type
 >;
 
 //! ASCII output floating-point precision in digits
@@ -74,7 +87,8 @@ using floatformat = tk::tuple::tagged_tuple<
 using intervals = tk::tuple::tagged_tuple<
   tag::tty,   kw::ttyi::info::expect::type,       //!< TTY output interval
   tag::field, kw::interval::info::expect::type,   //!< Field output interval
-  tag::diag,  kw::interval::info::expect::type    //!< Diags output interval
+  tag::diag,  kw::interval::info::expect::type,   //!< Diags output interval
+  tag::lb,    kw::lbfreq::info::expect::type      //!< Load balancing interval
 >;
 
 //! IO parameters storage
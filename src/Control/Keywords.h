@@ -2824,6 +2824,25 @@ struct reorder_info {
 };
 using reorder = keyword< reorder_info, TAOCPP_PEGTL_STRING("reorder") >;
 
+struct derived_info {
+  static std::string name() { return "derived"; }
+  static std::string shortDescription() { return
+    "Store derived data structures in output mesh"; }
+  static std::string longDescription() { return
+    R"(This option is used to instruct the mesh converter to also compute and
+    store derived data structures, elements surrounding points and points
+    surrounding points, in the output mesh file. This is only supported by
+    the native binary mesh format, selected by the output file extension
+    'qmesh', and is ignored for other output formats.)";
+  }
+  using alias = Alias< D >;
+  struct expect {
+    using type = std::string;
+    static std::string description() { return "string"; }
+  };
+};
+using derived = keyword< derived_info, TAOCPP_PEGTL_STRING("derived") >;
+
 struct group_info {
   static std::string name() { return "group"; }
   static std::string shortDescription() { return
@@ -3695,6 +3714,20 @@ struct phg_info {
 };
 using phg = keyword< phg_info, TAOCPP_PEGTL_STRING("phg") >;
 
+struct graph_info {
+  static std::string name() { return "graph"; }
+  static std::string shortDescription() { return
+    "Select edge-cut minimizing graph mesh partitioner"; }
+  static std::string longDescription() { return
+    R"(This keyword is used to select the parallel graph mesh partitioner. The
+    graph partitioner operates on the (weighted) element dual graph, whose
+    vertices are the mesh elements and whose edges connect elements sharing a
+    face, and minimizes the number of edges cut by the partition boundaries,
+    i.e., the size of the partition (chare) surfaces. See
+    Control/Options/PartitioningAlgorithm.h for other valid options.)"; }
+};
+using graph = keyword< graph_info, TAOCPP_PEGTL_STRING("graph") >;
+
 struct algorithm_info {
   static std::string name() { return "algorithm"; }
   static std::string shortDescription() { return
@@ -3709,7 +3742,8 @@ struct algorithm_info {
                   + rib::string() + "\' | \'"
                   + hsfc::string() + "\' | \'"
                   + mj::string() + "\' | \'"
-                  + phg::string() + '\'';
+                  + phg::string() + "\' | \'"
+                  + graph::string() + '\'';
     }
   };
 };
@@ -3728,6 +3762,220 @@ struct partitioning_info {
 };
 using partitioning = keyword< partitioning_info, TAOCPP_PEGTL_STRING("partitioning") >;
 
+struct hypre_info {
+  static std::string name() { return "Hypre"; }
+  static std::string shortDescription() { return
+    "Select the Hypre conjugate gradients linear solver"; }
+  static std::string longDescription() { return
+    R"(This keyword is used to select the distributed preconditioned conjugate
+    gradients linear solver of the Hypre library, see
+    https://computation.llnl.gov/projects/hypre-scalable-linear-solvers-multigrid-methods.
+    With Hypre, the preconditioners 'none', 'jacobi', 'ilu0' (using Hypre's
+    Euclid), 'amg', and 'parasails' are available. See
+    Control/Options/LinearSolver.h for other valid options.)"; }
+};
+using hypre = keyword< hypre_info, TAOCPP_PEGTL_STRING("hypre") >;
+
+struct cg_info {
+  static std::string name() { return "CG"; }
+  static std::string shortDescription() { return
+    "Select the native conjugate gradients linear solver"; }
+  static std::string longDescription() { return
+    R"(This keyword is used to select the native (Charm++) distributed
+    preconditioned conjugate gradients linear solver. This solver does not
+    depend on an external library. Note that the conjugate gradients method
+    assumes a symmetric positive definite matrix. See
+    Control/Options/LinearSolver.h for other valid options.)"; }
+};
+using cg = keyword< cg_info, TAOCPP_PEGTL_STRING("cg") >;
+
+struct gmres_info {
+  static std::string name() { return "GMRES"; }
+  static std::string shortDescription() { return
+    "Select the native restarted GMRES linear solver"; }
+  static std::string longDescription() { return
+    R"(This keyword is used to select the native (Charm++) distributed
+    right-preconditioned restarted generalized minimal residual (GMRES) linear
+    solver. This solver does not depend on an external library and, unlike
+    conjugate gradients, does not require a symmetric matrix. See
+    Control/Options/LinearSolver.h for other valid options.)"; }
+};
+using gmres = keyword< gmres_info, TAOCPP_PEGTL_STRING("gmres") >;
+
+struct solver_info {
+  static std::string name() { return "Linear solver"; }
+  static std::string shortDescription() { return
+    "Select linear solver"; }
+  static std::string longDescription() { return
+    R"(This keyword is used to select a linear solver, used to solve the
+    linear systems arising from the matcg discretization scheme. See
+    Control/Options/LinearSolver.h for valid options.)"; }
+  struct expect {
+    static std::string description() { return "string"; }
+    static std::string choices() {
+      return '\'' + hypre::string() + "\' | \'"
+                  + cg::string() + "\' | \'"
+                  + gmres::string() + '\'';
+    }
+  };
+};
+using solver = keyword< solver_info, TAOCPP_PEGTL_STRING("solver") >;
+
+struct pc_none_info {
+  static std::string name() { return "none"; }
+  static std::string shortDescription() { return
+    "Select no preconditioner"; }
+  static std::string longDescription() { return
+    R"(This keyword is used to select no preconditioning for the native linear
+    solvers. See Control/Options/Preconditioner.h for other valid
+    options.)"; }
+};
+using pc_none = keyword< pc_none_info, TAOCPP_PEGTL_STRING("none") >;
+
+struct jacobi_info {
+  static std::string name() { return "Jacobi"; }
+  static std::string shortDescription() { return
+    "Select the Jacobi (diagonal) preconditioner"; }
+  static std::string longDescription() { return
+    R"(This keyword is used to select the Jacobi, i.e., diagonal scaling,
+    preconditioner for the native linear solvers. See
+    Control/Options/Preconditioner.h for other valid options.)"; }
+};
+using jacobi = keyword< jacobi_info, TAOCPP_PEGTL_STRING("jacobi") >;
+
+struct ilu0_info {
+  static std::string name() { return "block-Jacobi/ILU(0)"; }
+  static std::string shortDescription() { return
+    "Select the block-Jacobi preconditioner with ILU(0) blocks"; }
+  static std::string longDescription() { return
+    R"(This keyword is used to select the block-Jacobi preconditioner for the
+    native linear solvers, in which each block is the part of the matrix
+    coupling the rows owned by a processing element (PE), approximately
+    inverted by its incomplete LU factorization with zero fill-in, ILU(0). See
+    Control/Options/Preconditioner.h for other valid options.)"; }
+};
+using ilu0 = keyword< ilu0_info, TAOCPP_PEGTL_STRING("ilu0") >;
+
+struct amg_info {
+  static std::string name() { return "BoomerAMG"; }
+  static std::string shortDescription() { return
+    "Select the algebraic multigrid preconditioner"; }
+  static std::string longDescription() { return
+    R"(This keyword is used to select Hypre's parallel algebraic multigrid
+    preconditioner, BoomerAMG. Its cost per iteration is higher than that of
+    simpler preconditioners, but the number of iterations it requires is
+    approximately independent of the mesh size. Only available with the Hypre
+    linear solver. See Control/Options/Preconditioner.h for other valid
+    options.)"; }
+};
+using amg = keyword< amg_info, TAOCPP_PEGTL_STRING("amg") >;
+
+struct parasails_info {
+  static std::string name() { return "ParaSails"; }
+  static std::string shortDescription() { return
+    "Select the sparse approximate inverse preconditioner"; }
+  static std::string longDescription() { return
+    R"(This keyword is used to select Hypre's parallel sparse approximate
+    inverse preconditioner, ParaSails. Only available with the Hypre linear
+    solver. See Control/Options/Preconditioner.h for other valid options.)"; }
+};
+using parasails = keyword< parasails_info, TAOCPP_PEGTL_STRING("parasails") >;
+
+struct linsolver_stats_info {
+  static std::string name() { return "Linear solver statistics"; }
+  static std::string shortDescription() { return
+    "Turn output of linear solver statistics on/off"; }
+  static std::string longDescription() { return
+    R"(This keyword can be used to turn on/off appending the number of
+    iterations and the final relative residual of the last linear solve to
+    each line of the diagnostics file, in columns 'linit' and 'linres'. This
+    helps tuning the linear solver and preconditioner. Default: false. Note
+    that this keyword is only used in conjunction with the matcg scheme.)"; }
+  struct expect {
+    using type = bool;
+    static std::string description() { return "string"; }
+    static std::string choices() { return "true | false"; }
+  };
+};
+using linsolver_stats =
+  keyword< linsolver_stats_info, TAOCPP_PEGTL_STRING("stats") >;
+
+struct linsolver_tol_info {
+  static std::string name() { return "Linear solver tolerance"; }
+  static std::string shortDescription() { return
+    "Set linear solver convergence tolerance"; }
+  static std::string longDescription() { return
+    R"(This keyword is used to set the convergence tolerance of the linear
+    solver, inside a linsolver ... end block. The solve is considered converged
+    once the norm of the residual relative to the norm of the right-hand side
+    drops below this value. Default: 1.0e-14. Example: "tol 1.0e-10".)"; }
+  struct expect {
+    using type = tk::real;
+    static constexpr type lower = 0.0;
+    static std::string description() { return "real"; }
+  };
+};
+using linsolver_tol =
+  keyword< linsolver_tol_info, TAOCPP_PEGTL_STRING("tol") >;
+
+struct linsolver_maxit_info {
+  static std::string name() { return "Linear solver maximum iterations"; }
+  static std::string shortDescription() { return
+    "Set maximum number of linear solver iterations"; }
+  static std::string longDescription() { return
+    R"(This keyword is used to set the maximum number of iterations of the
+    linear solver, inside a linsolver ... end block. If the solver reaches this
+    number of iterations without converging to the tolerance, see
+    ')" + linsolver_tol::string() + R"(', a warning is printed and the
+    solution of the last iteration is used. Default: 1000. Example:
+    "maxit 200".)"; }
+  struct expect {
+    using type = uint32_t;
+    static constexpr type lower = 1;
+    static std::string description() { return "uint"; }
+  };
+};
+using linsolver_maxit =
+  keyword< linsolver_maxit_info, TAOCPP_PEGTL_STRING("maxit") >;
+
+struct preconditioner_info {
+  static std::string name() { return "Preconditioner"; }
+  static std::string shortDescription() { return
+    "Select linear solver preconditioner"; }
+  static std::string longDescription() { return
+    R"(This keyword is used to select a preconditioner for the native linear
+    solvers. See Control/Options/Preconditioner.h for valid options.)"; }
+  struct expect {
+    static std::string description() { return "string"; }
+    static std::string choices() {
+      return '\'' + pc_none::string() + "\' | \'"
+                  + jacobi::string() + "\' | \'"
+                  + ilu0::string() + "\' | \'"
+                  + amg::string() + "\' | \'"
+                  + parasails::string() + '\'';
+    }
+  };
+};
+using preconditioner =
+  keyword< preconditioner_info, TAOCPP_PEGTL_STRING("preconditioner") >;
+
+struct linsolver_info {
+  static std::string name() { return "linsolver"; }
+  static std::string shortDescription() { return
+    "Start configuration block for the linear solver"; }
+  static std::string longDescription() { return
+    R"(This keyword is used to introduce a linsolver ... end block, used to
+    specify the configuration of the linear solver. Keywords allowed
+    in a linsolver ... end block: )" + std::string("\'")
+    + solver::string() + "\', \'"
+    + preconditioner::string() + "\', \'"
+    + linsolver_tol::string() + "\', \'"
+    + linsolver_maxit::string() + "\', \'"
+    + linsolver_stats::string() + "\'.";
+  }
+};
+using linsolver = keyword< linsolver_info, TAOCPP_PEGTL_STRING("linsolver") >;
+
 struct amr_uniform_info {
   using code = Code< u >;
   static std::string name() { return "uniform"; }
@@ -3970,6 +4218,181 @@ struct fct_info {
 };
 using fct = keyword< fct_info, TAOCPP_PEGTL_STRING("fct") >;
 
+struct fused_rhs_info {
+  static std::string name() { return "Fused right-hand side"; }
+  static std::string shortDescription() { return
+    "Turn single-pass right-hand side computation on/off"; }
+  static std::string longDescription() { return
+    R"(This keyword can be used to turn on/off computing the right-hand side of
+    the two-step Lax-Wendroff continuous Galerkin discretization in a single
+    pass over the mesh elements. If true, the element-centered half-step
+    solution is not stored but kept in local storage and immediately scattered
+    to the mesh nodes in the same element loop. If false (the default), the
+    half-step solution is computed and stored for all elements in a first pass
+    and scattered to the nodes in a second. The two yield the same result. Note
+    that this keyword is only used in conjunction with continuous Galerkin
+    finite element discretization, configured by schemes matcg or diagcg, and
+    it has no effect when the discontinuous Galerkin (DG) scheme is used.)"; }
+  struct expect {
+    using type = bool;
+    static std::string description() { return "string"; }
+    static std::string choices() { return "true | false"; }
+  };
+};
+using fused_rhs =
+  keyword< fused_rhs_info, TAOCPP_PEGTL_STRING("fused_rhs") >;
+
+struct local_reorder_info {
+  static std::string name() { return "Local mesh reordering"; }
+  static std::string shortDescription() { return
+    "Turn renumbering mesh nodes and elements of mesh chunks on/off"; }
+  static std::string longDescription() { return
+    R"(This keyword can be used to turn on/off renumbering the mesh nodes and
+    elements of each mesh chunk (held by a worker chare) for data locality. If
+    true, the local node IDs are assigned using the reverse Cuthill-McKee
+    algorithm and the elements are reordered in ascending order of their lowest
+    node ID, so that element loops gathering from and scattering to nodes access
+    memory in a more cache-friendly order. If false (the default), local node
+    IDs follow the order of the global node IDs and elements are in the order
+    produced by the mesh partitioner.)"; }
+  struct expect {
+    using type = bool;
+    static std::string description() { return "string"; }
+    static std::string choices() { return "true | false"; }
+  };
+};
+using local_reorder =
+  keyword< local_reorder_info, TAOCPP_PEGTL_STRING("local_reorder") >;
+
+struct aggregate_info {
+  static std::string name() { return "Message aggregation"; }
+  static std::string shortDescription() { return
+    "Turn per-PE aggregation of chare-boundary messages on/off"; }
+  static std::string longDescription() { return
+    R"(This keyword can be used to turn on/off combining the chare-boundary
+    messages of worker chares residing on the same processing element (PE). If
+    true, messages bound to chares on the same PE are delivered by direct
+    function calls and those bound to chares on the same remote PE are combined
+    into a single message. This makes a high degree of virtualization (many
+    chares per PE) more affordable. If false (the default), every pair of
+    communicating chares exchanges separate messages. Note that this keyword is
+    only used in conjunction with the diagcg scheme, for which it applies to
+    all chare-boundary exchanges, including those of flux-corrected transport
+    (FCT).)"; }
+  struct expect {
+    using type = bool;
+    static std::string description() { return "string"; }
+    static std::string choices() { return "true | false"; }
+  };
+};
+using aggregate =
+  keyword< aggregate_info, TAOCPP_PEGTL_STRING("aggregate") >;
+
+struct fwd_euler_info {
+  static std::string name() { return "Forward Euler"; }
+  static std::string shortDescription() { return
+    "Select single-stage forward Euler time integration"; }
+  static std::string longDescription() { return
+    R"(This keyword is used to select the first-order, single-stage, explicit
+    forward Euler time integration scheme. See
+    Control/Inciter/Options/TimeIntegration.h for other valid options.)"; }
+};
+using fwd_euler = keyword< fwd_euler_info, TAOCPP_PEGTL_STRING("fwd_euler") >;
+
+struct ssprk2_info {
+  static std::string name() { return "SSP-RK2"; }
+  static std::string shortDescription() { return
+    "Select two-stage strong-stability-preserving Runge-Kutta time integration";
+  }
+  static std::string longDescription() { return
+    R"(This keyword is used to select the second-order, two-stage, explicit
+    strong-stability-preserving Runge-Kutta (SSP-RK2) time integration scheme
+    of Shu and Osher. See Control/Inciter/Options/TimeIntegration.h for other
+    valid options.)"; }
+};
+using ssprk2 = keyword< ssprk2_info, TAOCPP_PEGTL_STRING("ssprk2") >;
+
+struct ssprk3_info {
+  static std::string name() { return "SSP-RK3"; }
+  static std::string shortDescription() { return
+    "Select three-stage strong-stability-preserving Runge-Kutta time "
+    "integration"; }
+  static std::string longDescription() { return
+    R"(This keyword is used to select the third-order, three-stage, explicit
+    strong-stability-preserving Runge-Kutta (SSP-RK3) time integration scheme
+    of Shu and Osher. See Control/Inciter/Options/TimeIntegration.h for other
+    valid options.)"; }
+};
+using ssprk3 = keyword< ssprk3_info, TAOCPP_PEGTL_STRING("ssprk3") >;
+
+struct time_integration_info {
+  static std::string name() { return "Time integration"; }
+  static std::string shortDescription() { return
+    "Select explicit time integration scheme"; }
+  static std::string longDescription() { return
+    R"(This keyword is used to select the explicit time integration scheme used
+    to advance the discrete equations in time with the discontinuous Galerkin
+    (DG) and the diagonal continuous Galerkin (DiagCG) schemes. Each stage of a
+    multi-stage scheme exchanges chare-boundary data before evaluating the
+    right-hand side. See Control/Inciter/Options/TimeIntegration.h for valid
+    options.)"; }
+  struct expect {
+    static std::string description() { return "string"; }
+    static std::string choices() {
+      return '\'' + fwd_euler::string() + "\' | \'"
+                  + ssprk2::string() + "\' | \'"
+                  + ssprk3::string() + '\'';
+    }
+  };
+};
+using time_integration =
+  keyword< time_integration_info, TAOCPP_PEGTL_STRING("time_integration") >;
+
+struct lbfreq_info {
+  static std::string name() { return "Load balancing frequency"; }
+  static std::string shortDescription() { return
+    "Set load balancing frequency"; }
+  static std::string longDescription() { return
+    R"(This keyword is used to specify the frequency, in time steps, at which
+    the worker chares of the discontinuous Galerkin (DG) and the diagonal
+    continuous Galerkin (DiagCG) schemes synchronize to allow the Charm++
+    runtime system to migrate them among processing elements based on measured
+    load. Zero (the default) disables load balancing. The load balancer itself
+    is selected at runtime via the Charm++ command line argument '+balancer',
+    e.g., '+balancer GreedyLB'.)";
+  }
+  struct expect {
+    using type = uint32_t;
+    static constexpr type lower = 0;
+    static std::string description() { return "uint"; }
+  };
+};
+using lbfreq = keyword< lbfreq_info, TAOCPP_PEGTL_STRING("lbfreq") >;
+
+struct nwriter_info {
+  static std::string name() { return "Number of field writers"; }
+  static std::string shortDescription() { return
+    "Set number of aggregating field output writers"; }
+  static std::string longDescription() { return
+    R"(This keyword is used to specify the number of writers that aggregate
+    mesh-based field output of all worker chares, inside a plotvar ... end
+    block. Zero (the default) writes a separate ExodusII file per worker chare.
+    A positive number, N, funnels the output of the worker chares through N
+    writers, residing on different processing elements, each of which merges
+    the mesh chunks and fields received into a single ExodusII file that
+    contains all time steps, thus N files are written instead of one per
+    worker chare. N is limited by the number of processing elements and the
+    number of worker chares. Note that this keyword is only used with ExodusII
+    field output.)";
+  }
+  struct expect {
+    using type = uint32_t;
+    static constexpr type lower = 0;
+    static std::string description() { return "uint"; }
+  };
+};
+using nwriter = keyword< nwriter_info, TAOCPP_PEGTL_STRING("nwriter") >;
+
 ////////// NOT YET FULLY DOCUMENTED //////////
 
 struct mix_iem_info {
@@ -36,6 +36,7 @@ class CmdLine :
                       tag::io,      ios,
                       tag::verbose, bool,
                       tag::reorder, bool,
+                      tag::derived, bool,
                       tag::help,    bool,
                       tag::helpctr, bool,
                       tag::cmdinfo, tk::ctr::HelpFactory,
@@ -51,6 +52,7 @@ class CmdLine :
                                     , kw::input
                                     , kw::output
                                     , kw::reorder
+                                    , kw::derived
                                     >;
 
     //! \brief Constructor: set defaults.
@@ -62,6 +64,7 @@ class CmdLine :
     CmdLine() {
       set< tag::verbose >( false ); // Use quiet output by default
       set< tag::reorder >( false ); // Do not reorder by default
+      set< tag::derived >( false ); // Do not store derived data by default
       // Initialize help: fill from own keywords
       boost::mpl::for_each< keywords >( tk::ctr::Info( get< tag::cmdinfo >() ) );
     }
@@ -74,6 +77,7 @@ class CmdLine :
       tk::Control< tag::io,       ios,
                    tag::verbose,  bool,
                    tag::reorder,  bool,
+                   tag::derived,  bool,
                    tag::help,     bool,
                    tag::helpctr,  bool,
                    tag::cmdinfo,  tk::ctr::HelpFactory,
@@ -36,6 +36,10 @@ namespace cmd {
   struct reorder :
          tk::grm::process_cmd_switch< use< kw::reorder >, tag::reorder > {};
 
+  //! brief Match and set derived switch (i.e., store derived data or not)
+  struct derived :
+         tk::grm::process_cmd_switch< use< kw::derived >, tag::derived > {};
+
   //! \brief Match and set io parameter
   template< typename keyword, typename io_tag >
   struct io :
@@ -55,6 +59,7 @@ namespace cmd {
   struct keywords :
          pegtl::sor< verbose,
                      reorder,
+                     derived,
                      help,
                      helpkw,
                      io< use< kw::input >, tag::input >,
@@ -0,0 +1,62 @@
+// *****************************************************************************
+/*!
+  \file      src/Control/Options/LinearSolver.h
+  \copyright 2012-2015, J. Bakosi, 2016-2018, Los Alamos National Security, LLC.
+  \brief     Linear solver options
+  \details   Linear solver options
+*/
+// *****************************************************************************
+#ifndef LinearSolverOptions_h
+#define LinearSolverOptions_h
+
+#include <boost/mpl/vector.hpp>
+#include "NoWarning/for_each.h"
+
+#include "Toggle.h"
+#include "Keywords.h"
+#include "PUPUtil.h"
+
+namespace tk {
+namespace ctr {
+
+//! Linear solver types
+enum class LinearSolverType : uint8_t { HYPRE
+                                      , CG
+                                      , GMRES };
+
+//! \brief Pack/Unpack LinearSolverType: forward overload to generic enum class
+//!   packer
+inline void operator|( PUP::er& p, LinearSolverType& e ) { PUP::pup( p, e ); }
+
+//! \brief LinearSolver options: outsource searches to base templated on enum
+//!   type
+class LinearSolver : public tk::Toggle< LinearSolverType > {
+
+  public:
+    //! Valid expected choices to make them also available at compile-time
+    using keywords = boost::mpl::vector< kw::hypre
+                                       , kw::cg
+                                       , kw::gmres
+                                       >;
+
+    //! \brief Options constructor
+    //! \details Simply initialize in-line and pass associations to base, which
+    //!    will handle client interactions
+    explicit LinearSolver() :
+      tk::Toggle< LinearSolverType >(
+        //! Group, i.e., options, name
+        kw::solver::name(),
+        //! Enums -> names
+        { { LinearSolverType::HYPRE, kw::hypre::name() },
+          { LinearSolverType::CG, kw::cg::name() },
+          { LinearSolverType::GMRES, kw::gmres::name() } },
+        //! keywords -> Enums
+        { { kw::hypre::string(), LinearSolverType::HYPRE },
+          { kw::cg::string(), LinearSolverType::CG },
+          { kw::gmres::string(), LinearSolverType::GMRES } } ) {}
+};
+
+} // ctr::
+} // tk::
+
+#endif // LinearSolverOptions_h
@@ -25,7 +25,8 @@ enum class PartitioningAlgorithmType : uint8_t { RCB,
                                                  RIB,
                                                  HSFC,
                                                  MJ,
-                                                 PHG };
+                                                 PHG,
+                                                 GRAPH };
 
 //! \brief Pack/Unpack PartitioningAlgorithmType: forward overload to generic
 //!   enum class packer
@@ -45,6 +46,7 @@ class PartitioningAlgorithm : public tk::Toggle< PartitioningAlgorithmType > {
                                        , kw::hsfc
                                        , kw::mj
                                        , kw::phg
+                                       , kw::graph
                                        >;
 
     //! \brief Options constructor
@@ -59,13 +61,15 @@ class PartitioningAlgorithm : public tk::Toggle< PartitioningAlgorithmType > {
           { PartitioningAlgorithmType::RIB, kw::rib::name() },
           { PartitioningAlgorithmType::HSFC, kw::hsfc::name() },
           { PartitioningAlgorithmType::MJ, kw::mj::name() },
-          { PartitioningAlgorithmType::PHG, kw::phg::name() } },
+          { PartitioningAlgorithmType::PHG, kw::phg::name() },
+          { PartitioningAlgorithmType::GRAPH, kw::graph::name() } },
         //! keywords -> Enums
         { { kw::rcb::string(), PartitioningAlgorithmType::RCB },
           { kw::rib::string(), PartitioningAlgorithmType::RIB },
           { kw::hsfc::string(), PartitioningAlgorithmType::HSFC },
           { kw::mj::string(), PartitioningAlgorithmType::MJ },
-          { kw::phg::string(), PartitioningAlgorithmType::PHG } } ) {}
+          { kw::phg::string(), PartitioningAlgorithmType::PHG },
+          { kw::graph::string(), PartitioningAlgorithmType::GRAPH } } ) {}
 
     //! \brief Return parameter based on Enum
     //! \details Here 'parameter' is the library-specific identifier of the
@@ -101,7 +105,8 @@ class PartitioningAlgorithm : public tk::Toggle< PartitioningAlgorithmType > {
       { PartitioningAlgorithmType::RIB, "rib" },
       { PartitioningAlgorithmType::HSFC, "hsfc" },
       { PartitioningAlgorithmType::MJ, "multijagged" },
-      { PartitioningAlgorithmType::PHG, "phg" }
+      { PartitioningAlgorithmType::PHG, "phg" },
+      { PartitioningAlgorithmType::GRAPH, "zoltan" }
     };
 };
 
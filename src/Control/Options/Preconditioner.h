@@ -0,0 +1,70 @@
+// *****************************************************************************
+/*!
+  \file      src/Control/Options/Preconditioner.h
+  \copyright 2012-2015, J. Bakosi, 2016-2018, Los Alamos National Security, LLC.
+  \brief     Linear solver preconditioner options
+  \details   Linear solver preconditioner options
+*/
+// *****************************************************************************
+#ifndef PreconditionerOptions_h
+#define PreconditionerOptions_h
+
+#include <boost/mpl/vector.hpp>
+#include "NoWarning/for_each.h"
+
+#include "Toggle.h"
+#include "Keywords.h"
+#include "PUPUtil.h"
+
+namespace tk {
+namespace ctr {
+
+//! Preconditioner types
+enum class PreconditionerType : uint8_t { NONE
+                                        , JACOBI
+                                        , ILU0
+                                        , AMG
+                                        , PARASAILS };
+
+//! \brief Pack/Unpack PreconditionerType: forward overload to generic enum
+//!   class packer
+inline void operator|( PUP::er& p, PreconditionerType& e ) { PUP::pup( p, e ); }
+
+//! \brief Preconditioner options: outsource searches to base templated on enum
+//!   type
+class Preconditioner : public tk::Toggle< PreconditionerType > {
+
+  public:
+    //! Valid expected choices to make them also available at compile-time
+    using keywords = boost::mpl::vector< kw::pc_none
+                                       , kw::jacobi
+                                       , kw::ilu0
+                                       , kw::amg
+                                       , kw::parasails
+                                       >;
+
+    //! \brief Options constructor
+    //! \details Simply initialize in-line and pass associations to base, which
+    //!    will handle client interactions
+    explicit Preconditioner() :
+      tk::Toggle< PreconditionerType >(
+        //! Group, i.e., options, name
+        kw::preconditioner::name(),
+        //! Enums -> names
+        { { PreconditionerType::NONE, kw::pc_none::name() },
+          { PreconditionerType::JACOBI, kw::jacobi::name() },
+          { PreconditionerType::ILU0, kw::ilu0::name() },
+          { PreconditionerType::AMG, kw::amg::name() },
+          { PreconditionerType::PARASAILS, kw::parasails::name() } },
+        //! keywords -> Enums
+        { { kw::pc_none::string(), PreconditionerType::NONE },
+          { kw::jacobi::string(), PreconditionerType::JACOBI },
+          { kw::ilu0::string(), PreconditionerType::ILU0 },
+          { kw::amg::string(), PreconditionerType::AMG },
+          { kw::parasails::string(), PreconditionerType::PARASAILS } } ) {}
+};
+
+} // ctr::
+} // tk::
+
+#endif // PreconditionerOptions_h
@@ -29,6 +29,7 @@ struct verbose {};
 struct benchmark {};
 struct feedback {};
 struct reorder {};
+struct derived {};
 struct error {};
 struct pdf {};
 struct ordpdf {};
@@ -68,6 +69,8 @@ struct pde {};
 struct amr {};
 struct levels {};
 struct partitioner {};
+struct linsolver {};
+struct preconditioner {};
 struct scheme {};
 struct initpolicy {};
 struct coeffpolicy {};
@@ -79,6 +82,14 @@ struct dt {};
 struct cfl {};
 struct fct {};
 struct ctau {};
+struct fusedrhs {};
+struct localreorder {};
+struct aggregate {};
+struct linstats {};
+struct lintol {};
+struct linmaxit {};
+struct nwriter {};
+struct timeint {};
 struct npar {};
 struct refined {};
 struct part {};
@@ -131,6 +142,7 @@ struct selected {};
 struct discr {};
 struct component {};
 struct interval {};
+struct lb {};
 struct cmd {};
 struct param {};
 struct init {};
@@ -171,6 +183,7 @@ struct bcast {};
 struct elem {};
 struct avecost {};
 struct stdcost {};
+struct edgecut {};
 struct flux {};
 
 struct BirthdaySpacings {};
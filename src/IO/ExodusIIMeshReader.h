@@ -98,6 +98,9 @@ class ExodusIIMeshReader {
     //! Read node list of all side sets from ExodusII file
     std::map< int, std::vector< std::size_t > > readSidesets();
 
+    //! Read node and face lists of all side sets into mesh object
+    void readSidesets( UnsMesh& mesh );
+
     //! Read face list of all side sets from ExodusII file
     std::size_t
     readSidesetFaces( std::map< int, std::vector< std::size_t > >& belem );
@@ -128,6 +131,10 @@ class ExodusIIMeshReader {
     //! Read all element blocks and mesh connectivity from ExodusII file
     void readAllElements( UnsMesh& mesh );
 
+    //! \brief Largest gap in node IDs across which readNodes() coalesces
+    //!   requested nodes into a single contiguous read
+    static constexpr std::size_t RANGE_GAP = 64;
+
     const std::string m_filename;          //!< File name
     //! \brief List of number of nodes per element for different element types
     //!   supported in the order of tk::ExoElemType
@@ -38,6 +38,15 @@ class ExodusIIMeshWriter {
     //! Destructor
     ~ExodusIIMeshWriter() noexcept;
 
+    //! Don't permit copy constructor
+    ExodusIIMeshWriter( const ExodusIIMeshWriter& ) = delete;
+    //! Don't permit copy assigment
+    ExodusIIMeshWriter& operator=( const ExodusIIMeshWriter& ) = delete;
+    //! Don't permit move constructor
+    ExodusIIMeshWriter( ExodusIIMeshWriter&& ) = delete;
+    //! Don't permit move assigment
+    ExodusIIMeshWriter& operator=( ExodusIIMeshWriter&& ) = delete;
+
     //! Write ExodusII mesh to file
     void writeMesh( const UnsMesh& mesh ) const;
 
@@ -60,6 +69,16 @@ class ExodusIIMeshWriter {
                           int varid,
                           const std::vector< tk::real >& var ) const;
 
+    //!  Write all node scalar fields of a time step to ExodusII file
+    void writeNodeScalars(
+      uint64_t it,
+      const std::vector< std::vector< tk::real > >& var ) const;
+
+    //!  Write all elem scalar fields of a time step to ExodusII file
+    void writeElemScalars(
+      uint64_t it,
+      const std::vector< std::vector< tk::real > >& var ) const;
+
     //! Write header without mesh, function overloading
     void writeHeader( const char* title, int64_t ndim, int64_t nnodes,
 			    int64_t nelem, int64_t nblk, int64_t node_set,
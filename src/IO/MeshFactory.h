@@ -23,12 +23,14 @@ enum class MeshReader : uint8_t { GMSH=0,
                                   NETGEN,
                                   EXODUSII,
                                   HYPER,
-                                  ASC };
+                                  ASC,
+                                  NATIVE };
 
 //! Supported mesh writers
 enum class MeshWriter : uint8_t { GMSH=0,
                                   NETGEN,
-                                  EXODUSII };
+                                  EXODUSII,
+                                  NATIVE };
 
 //! Detect input mesh file type
 MeshReader
@@ -42,6 +44,7 @@ pickOutput( const std::string& filename );
 UnsMesh
 readUnsMesh( const tk::Print& print,
              const std::string& filename,
+             bool sidesets,
              std::pair< std::string, tk::real >& timestamp );
 
 //! Write unstructured mesh to file
@@ -49,7 +52,8 @@ std::vector< std::pair< std::string, tk::real > >
 writeUnsMesh( const tk::Print& print,
               const std::string& filename,
               UnsMesh& mesh,
-              bool reorder );
+              bool reorder,
+              bool derived );
 
 } // tk::
 
@@ -0,0 +1,87 @@
+// *****************************************************************************
+/*!
+  \file      src/IO/NativeMeshIO.h
+  \copyright 2012-2015, J. Bakosi, 2016-2018, Los Alamos National Security, LLC.
+  \brief     Native binary mesh file format
+  \details   Native binary mesh file format definition shared by the native
+    mesh reader and writer. A native mesh file consists of a fixed-size header,
+    tk::native::Header, followed by a number of sections. Each section is a
+    flat array of 8-byte words (tk::real or std::size_t) and starts at an
+    8-byte aligned byte offset given in the header. Thus, once the file is
+    mapped into memory, any section, or any contiguous part of it, e.g., the
+    connectivity of a chunk of elements, can be accessed in constant time
+    without parsing or decoding anything. Data is stored in the byte order of
+    the machine that wrote the file, which is checked by the reader.
+*/
+// *****************************************************************************
+#ifndef NativeMeshIO_h
+#define NativeMeshIO_h
+
+#include <cstdint>
+#include <cstddef>
+
+#include "Types.h"
+
+namespace tk {
+//! Native binary mesh file format
+namespace native {
+
+static_assert( sizeof(std::size_t) == sizeof(uint64_t),
+               "Native mesh format requires 8-byte std::size_t" );
+static_assert( sizeof(tk::real) == sizeof(uint64_t),
+               "Native mesh format requires 8-byte tk::real" );
+
+//! \brief Magic string at the beginning of the file
+//! \details Ends with a newline so that the first line, used by
+//!   tk::detectInput(), is short.
+const char MAGIC[8] = { 'Q', 'N', 'M', 'E', 'S', 'H', '\n', '\0' };
+
+//! File format version written and understood
+const uint64_t VERSION = 1;
+
+//! Byte order mark: reads back as a different value if endianness differs
+const uint64_t BOM = 0x0102030405060708ULL;
+
+//! Sections of a native mesh file in order of appearance in the file
+//! \details Side set tables, BNODESET and BFACESET, store three words per side
+//!   set: side set id, offset of the side set's list into BNODE or BFACE, and
+//!   the number of entries in the list. BNODE stores node IDs and BFACE stores
+//!   face IDs of the side sets, see also ExodusIIMeshReader::readSidesets()
+//!   and ExodusIIMeshReader::readSidesetFaces(). The derived data sections,
+//!   ESUP1, ESUP2, PSUP1, and PSUP2, are optional (empty if not written) and
+//!   store elements surrounding points and points surrounding points of the
+//!   tetrahedron mesh, see tk::genEsup() and tk::genPsup().
+enum class Section : uint8_t { X=0,
+                               Y,
+                               Z,
+                               TETINPOEL,
+                               TRIINPOEL,
+                               BNODESET,
+                               BNODE,
+                               BFACESET,
+                               BFACE,
+                               ESUP1,
+                               ESUP2,
+                               PSUP1,
+                               PSUP2 };
+
+//! Number of sections in a native mesh file
+const std::size_t NUMSECTION = 13;
+
+//! Native mesh file header
+struct Header {
+  char magic[8];                        //!< Magic string, see MAGIC
+  uint64_t version;                     //!< File format version
+  uint64_t bom;                         //!< Byte order mark, see BOM
+  uint64_t nsection;                    //!< Number of sections
+  uint64_t offset[ NUMSECTION ];        //!< Byte offsets of sections
+  uint64_t size[ NUMSECTION ];          //!< Number of words in sections
+};
+
+static_assert( sizeof(Header) % sizeof(uint64_t) == 0,
+               "Native mesh header size must be a multiple of 8 bytes" );
+
+} // native::
+} // tk::
+
+#endif // NativeMeshIO_h
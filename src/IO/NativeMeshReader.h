@@ -0,0 +1,128 @@
+// *****************************************************************************
+/*!
+  \file      src/IO/NativeMeshReader.h
+  \copyright 2012-2015, J. Bakosi, 2016-2018, Los Alamos National Security, LLC.
+  \brief     Native binary mesh reader class declaration
+  \details   Native binary mesh reader class declaration. The file is mapped
+    into memory, thus reading any part of it amounts to pointer arithmetic and
+    copying only what is asked for. See NativeMeshIO.h for the file format.
+*/
+// *****************************************************************************
+#ifndef NativeMeshReader_h
+#define NativeMeshReader_h
+
+#include <map>
+#include <array>
+#include <string>
+#include <vector>
+
+#include "Types.h"
+#include "Exception.h"
+#include "NativeMeshIO.h"
+
+namespace tk {
+
+class UnsMesh;
+
+//! Native binary mesh reader
+//! \details Mesh reader class facilitating reading a mesh from a file in the
+//!   native binary format, see NativeMeshIO.h, via a read-only memory map.
+//!   Besides reading the full mesh, the interface mirrors that of
+//!   ExodusIIMeshReader for reading parts of the mesh in parallel.
+class NativeMeshReader {
+
+  public:
+    //! Constructor: map file into memory and check header
+    explicit NativeMeshReader( const std::string& filename );
+
+    //! Destructor: unmap file
+    ~NativeMeshReader() noexcept;
+
+    //! Don't permit copy constructor
+    NativeMeshReader( const NativeMeshReader& ) = delete;
+    //! Don't permit copy assigment
+    NativeMeshReader& operator=( const NativeMeshReader& ) = delete;
+    //! Don't permit move constructor
+    NativeMeshReader( NativeMeshReader&& ) = delete;
+    //! Don't permit move assigment
+    NativeMeshReader& operator=( NativeMeshReader&& ) = delete;
+
+    //! Read native mesh from file
+    void readMesh( UnsMesh& mesh ) const;
+
+    //! Number of nodes in file
+    std::size_t nnode() const { return size( native::Section::X ); }
+
+    //! Number of tetrahedra in file
+    std::size_t ntet() const { return size( native::Section::TETINPOEL ) / 4; }
+
+    //! Read tetrahedron connectivity of a contiguous chunk of elements
+    void readElements( std::size_t from,
+                       std::size_t till,
+                       std::vector< std::size_t >& conn ) const;
+
+    //! Read coordinates of a number of mesh nodes
+    std::array< std::vector< tk::real >, 3 >
+    readNodes( const std::vector< std::size_t >& gid ) const;
+
+    //! Read node list of all side sets
+    std::map< int, std::vector< std::size_t > > readSidesets() const;
+
+    //! Read face list of all side sets
+    std::size_t readSidesetFaces(
+      std::map< int, std::vector< std::size_t > >& bface ) const;
+
+    //! Read face connectivity of a number of boundary faces
+    void readFaces( std::size_t nbfac, std::vector< std::size_t >& conn ) const;
+
+    //! Query if the file stores derived data (esup, psup)
+    bool derived() const { return size( native::Section::ESUP2 ) > 0; }
+
+    //! Read elements surrounding points of the tetrahedron mesh
+    std::pair< std::vector< std::size_t >, std::vector< std::size_t > >
+    readEsup() const;
+
+    //! Read points surrounding points of the tetrahedron mesh
+    std::pair< std::vector< std::size_t >, std::vector< std::size_t > >
+    readPsup() const;
+
+    //! Zero-copy access to a section of the memory-mapped file
+    //! \param[in] s Section to access
+    //! \return Pointer to the first word of the section in memory
+    template< typename T >
+    const T* data( native::Section s ) const {
+      static_assert( sizeof(T) == sizeof(uint64_t), "Need 8-byte type" );
+      return reinterpret_cast< const T* >( m_map + m_header->offset[ idx(s) ] );
+    }
+
+    //! Number of 8-byte words in a section
+    //! \param[in] s Section to query
+    //! \return Number of words in section
+    std::size_t size( native::Section s ) const
+    { return m_header->size[ idx(s) ]; }
+
+  private:
+    const std::string m_filename;       //!< File name
+    int m_fd;                           //!< File descriptor
+    std::size_t m_length;               //!< File length in bytes
+    const char* m_map;                  //!< Start of memory map of file
+    const native::Header* m_header;     //!< File header in memory map
+
+    //! Convert section enum to index
+    static std::size_t idx( native::Section s )
+    { return static_cast< std::size_t >( s ); }
+
+    //! Read side sets from a side set table and list
+    std::map< int, std::vector< std::size_t > >
+    readSets( native::Section table, native::Section list ) const;
+
+    //! Copy a section into a vector
+    std::vector< std::size_t > readSection( native::Section s ) const {
+      auto p = data< std::size_t >( s );
+      return std::vector< std::size_t >( p, p + size(s) );
+    }
+};
+
+} // tk::
+
+#endif // NativeMeshReader_h
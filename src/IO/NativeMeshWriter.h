@@ -0,0 +1,42 @@
+// *****************************************************************************
+/*!
+  \file      src/IO/NativeMeshWriter.h
+  \copyright 2012-2015, J. Bakosi, 2016-2018, Los Alamos National Security, LLC.
+  \brief     Native binary mesh writer class declaration
+  \details   Native binary mesh writer class declaration. See NativeMeshIO.h
+    for the file format.
+*/
+// *****************************************************************************
+#ifndef NativeMeshWriter_h
+#define NativeMeshWriter_h
+
+#include <string>
+#include <vector>
+
+#include "Writer.h"
+#include "NativeMeshIO.h"
+
+namespace tk {
+
+class UnsMesh;
+
+//! Native binary mesh writer
+//! \details Mesh writer class facilitating writing a mesh to a file in the
+//!   native binary format, see NativeMeshIO.h.
+class NativeMeshWriter : public Writer {
+
+  public:
+    //! Constructor
+    explicit NativeMeshWriter( const std::string& filename );
+
+    //! Write native mesh to file
+    void writeMesh( const UnsMesh& mesh, bool derived = false );
+
+  private:
+    //! Write a section of 8-byte words to file
+    void writeSection( const void* data, uint64_t size );
+};
+
+} // tk::
+
+#endif // NativeMeshWriter_h
@@ -0,0 +1,56 @@
+// *****************************************************************************
+/*!
+  \file      src/Inciter/AggMsg.h
+  \copyright 2016-2018, Los Alamos National Security, LLC.
+  \brief     Chare-boundary message combined by the per-PE Aggregator
+  \details   Chare-boundary message combined by the per-PE Aggregator.
+  \see       Aggregator.h for more info.
+*/
+// *****************************************************************************
+#ifndef AggMsg_h
+#define AggMsg_h
+
+#include <vector>
+
+#include "Types.h"
+#include "PUPUtil.h"
+
+namespace inciter {
+
+//! Chare-boundary message combined by the per-PE Aggregator
+struct AggMsg {
+
+  //! Entry method of the receiving chare a message is delivered to
+  enum class Kind : uint8_t { LHS     //!< DiagCG::comlhs()
+                            , RHS     //!< DiagCG::comrhs()
+                            , DIF     //!< DiagCG::comdif()
+                            , AEC     //!< DistFCT::comaecalw()
+                            , LIM     //!< DistFCT::comlim()
+                            };
+
+  int to;                         //!< Receiver chare ID
+  int from;                       //!< Sender chare ID (DiagCG only)
+  Kind kind;                      //!< Entry method to deliver to
+  std::vector< std::size_t > gid; //!< Global node IDs (DistFCT only)
+  std::vector< tk::real > data;   //!< Packed nodal values
+
+  ///@{
+  //! \brief Pack/Unpack serialize member function
+  //! \param[in,out] p Charm++'s PUP::er serializer object reference
+  void pup( PUP::er& p ) {
+    p | to;
+    p | from;
+    PUP::pup( p, kind );
+    p | gid;
+    p | data;
+  }
+  //! \brief Pack/Unpack serialize operator|
+  //! \param[in,out] p Charm++'s PUP::er serializer object reference
+  //! \param[in,out] m AggMsg object reference
+  friend void operator|( PUP::er& p, AggMsg& m ) { m.pup(p); }
+  //@}
+};
+
+} // inciter::
+
+#endif // AggMsg_h
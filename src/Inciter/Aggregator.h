@@ -0,0 +1,81 @@
+// *****************************************************************************
+/*!
+  \file      src/Inciter/Aggregator.h
+  \copyright 2016-2018, Los Alamos National Security, LLC.
+  \brief     Per-PE aggregation of chare-boundary messages
+  \details   Per-PE aggregation of chare-boundary messages.
+
+    With a high degree of virtualization many worker chares reside on the same
+    PE and exchange chare-boundary data with chares on the same PE or with
+    multiple chares residing on the same remote PE. Instead of sending a
+    separate message for each pair of communicating chares, workers post their
+    messages to the Aggregator branch on their PE. The branch schedules a
+    single flush at the lowest priority, which runs only after the PE has
+    processed all messages already in its queue, i.e., after all local chares
+    ready to communicate have posted their messages. At flush time, messages to
+    chares on the same PE are delivered by direct function calls, while those
+    to chares on other PEs are combined into a single message per destination
+    PE. Both the DiagCG workers and their (bound) DistFCT chare array elements
+    post their chare-boundary messages to the same branch.
+*/
+// *****************************************************************************
+#ifndef Aggregator_h
+#define Aggregator_h
+
+#include <vector>
+#include <unordered_map>
+
+#include "AggMsg.h"
+
+#include "NoWarning/diagcg.decl.h"
+#include "NoWarning/distfct.decl.h"
+#include "NoWarning/aggregator.decl.h"
+
+namespace inciter {
+
+//! Aggregator Charm++ group combining chare-boundary messages per PE
+class Aggregator : public CBase_Aggregator {
+
+  public:
+    //! Constructor
+    explicit Aggregator( const CProxy_DiagCG& worker,
+                         const CProxy_DistFCT& fct );
+
+    //! Post a DiagCG chare-boundary message for delivery at the next flush
+    void post( int tochare,
+               int fromch,
+               AggMsg::Kind kind,
+               const std::vector< tk::real >& data );
+
+    //! Post a DistFCT chare-boundary message for delivery at the next flush
+    void post( int tochare,
+               AggMsg::Kind kind,
+               const std::vector< std::size_t >& gid,
+               const std::vector< tk::real >& data );
+
+    //! Deliver all messages posted since the last flush
+    void flush();
+
+    //! Receive messages combined by a remote Aggregator branch
+    void recv( const std::vector< AggMsg >& msgs );
+
+  private:
+    //! Worker proxy messages are delivered to
+    CProxy_DiagCG m_worker;
+    //! Distributed FCT proxy (bound to the workers) messages are delivered to
+    CProxy_DistFCT m_fct;
+    //! True if a flush has already been scheduled
+    bool m_flush;
+    //! Messages posted since the last flush associated to destination PEs
+    std::unordered_map< int, std::vector< AggMsg > > m_out;
+
+    //! Bucket a message by destination PE and schedule a flush if needed
+    void enqueue( AggMsg&& m );
+
+    //! Deliver a message to a worker chare
+    void deliver( const AggMsg& m );
+};
+
+} // inciter::
+
+#endif // Aggregator_h
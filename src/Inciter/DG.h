@@ -39,8 +39,8 @@
       OwnGhost -> sendGhost [ style="solid" ];
       ReqGhost -> sendGhost [ style="solid" ];
       OwnSol [ label="OwnSol"
-               tooltip="own solution/unknown data computed"
-               URL="\ref inciter::DG::advance"];
+               tooltip="own solution/unknown data and rhs computed"
+               URL="\ref inciter::DG::stage"];
       ComSol [ label="ComSol"
                tooltip="communicated (ghost) solution/unknown data received"
                URL="\ref inciter::DG::comsol"];
@@ -126,12 +126,16 @@ class DG : public CBase_DG {
 
     //! Receive chare-boundary ghost data from neighboring chares
     void comsol( int fromch,
+                 std::size_t fromstage,
                  const std::vector< std::size_t >& tetid,
                  const std::vector< std::vector< tk::real > >& u );
 
     //! Evaluate whether to continue with next step
     void eval();
 
+    //! Continue time stepping after load balancing
+    void ResumeFromSync() override;
+
     //! Advance equations to next time step
     void advance( tk::real newdt );
 
@@ -143,6 +147,8 @@ class DG : public CBase_DG {
       p | m_ncomfac;
       p | m_nadj;
       p | m_nsol;
+      p | m_stage;
+      p | m_ownrhs;
       p | m_itf;
       p | m_disc;
       p | m_fd;
@@ -165,6 +171,9 @@ class DG : public CBase_DG {
       p | m_ghost;
       p | m_exptGhost;
       p | m_recvGhost;
+      p | m_chbfac;
+      p | m_chbpend;
+      p | m_solbuf;
       p | m_diag;
     }
     //! \brief Pack/Unpack serialize operator|
@@ -190,6 +199,11 @@ class DG : public CBase_DG {
     std::size_t m_nadj;
     //! Counter signaling that we have received all our solution ghost data
     std::size_t m_nsol;
+    //! Runge-Kutta stage counter
+    std::size_t m_stage;
+    //! \brief True if the right-hand side contributions requiring no ghost
+    //!   data have been computed in this Runge-Kutta stage
+    bool m_ownrhs;
     //! Field output iteration count
     uint64_t m_itf;
     //! Discretization proxy
@@ -198,7 +212,7 @@ class DG : public CBase_DG {
     FaceData m_fd;
     //! Vector of unknown/solution average over each mesh element
     tk::Fields m_u;
-    //! Vector of unknown at previous time-step
+    //! Vector of unknown at the beginning of the time step
     tk::Fields m_un;
     //! Total mesh volume
     tk::real m_vol;
@@ -245,6 +259,15 @@ class DG : public CBase_DG {
     std::set< std::size_t > m_exptGhost;
     //! Received ghost tet ids (used only in DEBUG)
     std::set< std::size_t > m_recvGhost;
+    //! Chare-boundary face ids associated to the fellow chare ids they border
+    std::unordered_map< int, std::vector< std::size_t > > m_chbfac;
+    //! \brief Fellow chare ids whose solution ghost data has been received in
+    //!   this stage before our own right-hand side contributions were computed
+    std::vector< int > m_chbpend;
+    //! \brief Solution ghost data received ahead of time from fellow chares
+    //!   already in the next Runge-Kutta stage, associated to chare IDs
+    std::unordered_map< int, std::pair< std::vector< std::size_t >,
+      std::vector< std::vector< tk::real > > > > m_solbuf;
     //! Diagnostics object
     ElemDiagnostics m_diag;
 
@@ -283,7 +306,16 @@ class DG : public CBase_DG {
     //! Compute left hand side
     void lhs();
 
-    //! Compute right hand side and solve system
+    //! Send solution ghost data to fellow chares
+    void sendSol();
+
+    //! Start a Runge-Kutta stage overlapping communication and computation
+    void stage();
+
+    //! Compute surface integrals on faces along the chare boundary with a chare
+    void chbIntegral( int fromch );
+
+    //! Advance the solution by a Runge-Kutta stage
     void solve();
 
     //! Output mesh and particle fields to files
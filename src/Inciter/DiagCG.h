@@ -86,6 +86,7 @@
 #include "NodeDiagnostics.h"
 #include "Inciter/InputDeck/InputDeck.h"
 #include "FaceData.h"
+#include "AggMsg.h"
 
 #include "NoWarning/diagcg.decl.h"
 
@@ -153,26 +154,26 @@ class DiagCG : public CBase_DiagCG {
     void advance( tk::real newdt );
 
     //! Receive contributions to left-hand side matrix on chare-boundaries
-    void comlhs( const std::vector< std::size_t >& gid,
-                 const std::vector< std::vector< tk::real > >& L );
+    void comlhs( int fromch, const std::vector< tk::real >& L );
 
     //! Receive contributions to right-hand side vector on chare-boundaries
-    void comrhs( const std::vector< std::size_t >& gid,
-                 const std::vector< std::vector< tk::real > >& R );
+    void comrhs( int fromch, const std::vector< tk::real >& R );
 
     //!  Receive contributions to RHS mass diffusion on chare-boundaries
-    void comdif( const std::vector< std::size_t >& gid,
-                 const std::vector< std::vector< tk::real > >& D );
+    void comdif( int fromch, const std::vector< tk::real >& D );
 
     //! Verify that solution does not change at Dirichlet boundary conditions
     bool correctBC( const tk::Fields& a );
 
-    //! Prepare for next step    
+    //! Complete Runge-Kutta stage and prepare for next stage or step
     void next( const tk::Fields& a );
 
     //! Evaluate whether to continue with next step
     void eval();
 
+    //! Continue time stepping after load balancing
+    void ResumeFromSync() override;
+
     ///@{
     //! \brief Pack/Unpack serialize member function
     //! \param[in,out] p Charm++'s PUP::er serializer object reference
@@ -183,10 +184,12 @@ class DiagCG : public CBase_DiagCG {
       p | m_nlhs;
       p | m_nrhs;
       p | m_ndif;
+      p | m_stage;
       p | m_disc;
       p | m_solver;
       p | m_side;
       p | m_u;
+      p | m_un;
       p | m_ul;
       p | m_du;
       p | m_dul;
@@ -197,6 +200,9 @@ class DiagCG : public CBase_DiagCG {
       p | m_lhsc;
       p | m_rhsc;
       p | m_difc;
+      p | m_chlid;
+      p | m_chbid;
+      p | m_chbuf;
       p | m_vol;
       p | m_diag;
     }
@@ -219,6 +225,8 @@ class DiagCG : public CBase_DiagCG {
     std::size_t m_nrhs;
     //! Counter for right-hand side masss-diffusion vector nodes updated
     std::size_t m_ndif;
+    //! Runge-Kutta stage counter
+    std::size_t m_stage;
     //! Discretization proxy
     CProxy_Discretization m_disc;
     //! Linear system merger and solver proxy
@@ -227,13 +235,15 @@ class DiagCG : public CBase_DiagCG {
     std::map< int, std::vector< std::size_t > > m_side;
     //! Unknown/solution vector at mesh nodes
     tk::Fields m_u;
+    //! Unknown/solution vector at mesh nodes at the beginning of the time step
+    tk::Fields m_un;
     //! Unknown/solution vector at mesh nodes (low orderd)
     tk::Fields m_ul;
     //! Unknown/solution vector increment (high order)
     tk::Fields m_du;
     //! Unknown/solution vector increment (low order)
     tk::Fields m_dul;
-    //! Unknown/solution vector at mesh cells
+    //! Unknown/solution vector at mesh cells, empty if the rhs is fused
     tk::Fields m_ue;
     //! Lumped lhs mass matrix
     tk::Fields m_lhs;
@@ -251,6 +261,14 @@ class DiagCG : public CBase_DiagCG {
       std::vector< std::pair< bool, tk::real > > > m_bc;
     //! Receive buffers for communication
     std::vector< std::vector< tk::real > > m_lhsc, m_rhsc, m_difc;
+    //! \brief Local node IDs of the nodes shared with fellow chares, ordered by
+    //!   global node ID, associated to fellow chare IDs
+    std::unordered_map< int, std::vector< std::size_t > > m_chlid;
+    //! \brief Chare-boundary node IDs (see Discretization::Bid()) of the nodes
+    //!   shared with fellow chares, in the same order as m_chlid
+    std::unordered_map< int, std::vector< std::size_t > > m_chbid;
+    //! Packed send buffers associated to fellow chare IDs, see pack()
+    std::unordered_map< int, std::vector< tk::real > > m_chbuf;
     //! Total mesh volume
     tk::real m_vol;
     //! Diagnostics object
@@ -272,6 +290,17 @@ class DiagCG : public CBase_DiagCG {
     //    user-specified boundary conditions
     void bc();
 
+    //! Pack nodal values on the chare boundary with a fellow chare
+    const std::vector< tk::real >& pack( int tochare, const tk::Fields& f );
+
+    //! Send nodal values on chare boundaries to all fellow chares
+    void send( AggMsg::Kind kind, const tk::Fields& f );
+
+    //! Add packed nodal values received from a fellow chare to a receive buffer
+    void unpack( int fromch,
+                 const std::vector< tk::real >& v,
+                 std::vector< std::vector< tk::real > >& recv ) const;
+
     //! Compute left-hand side of transport equations
     void lhs();
 
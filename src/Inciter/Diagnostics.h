@@ -14,7 +14,7 @@
 namespace inciter {
 
 //! Number of entries in diagnostics vector (of vectors)
-const std::size_t NUMDIAG = 6;
+const std::size_t NUMDIAG = 8;
 
 //! Diagnostics labels
 enum Diag { L2SOL=0,    //!< L2 norm of numerical solution
@@ -22,7 +22,9 @@ enum Diag { L2SOL=0,    //!< L2 norm of numerical solution
             LINFERR,    //!< L_inf norm of numerical-analytic solution
             ITER,       //!< Iteration count
             TIME,       //!< Physical time
-            DT };       //!< Time step size
+            DT,         //!< Time step size
+            LINIT,      //!< Linear solver iteration count
+            LINRES };   //!< Linear solver final relative residual
 
 } // inciter::
 
@@ -21,7 +21,6 @@
 #include "NoWarning/discretization.decl.h"
 
 namespace tk {
-  class ExodusIIMeshWriter;
   class RootMeshWriter;
 }
 
@@ -36,6 +35,8 @@ class Discretization : public CBase_Discretization {
     explicit
       Discretization(
         const CProxy_DistFCT& fctproxy,
+        const CProxy_Aggregator& aggproxy,
+        const CProxy_FieldWriter& fieldwriter,
         const CProxy_Transporter& transporter,
         const CProxy_BoundaryConditions& bc,
         const std::vector< std::size_t >& conn,
@@ -116,6 +117,12 @@ class Discretization : public CBase_Discretization {
       return m_fct[ thisIndex ].ckLocal();
     }
 
+    //! Access message aggregator group local branch pointer
+    Aggregator* Agg() const { return m_agg.ckLocalBranch(); }
+
+    //! Access message aggregator group proxy
+    const CProxy_Aggregator& AggProxy() const { return m_agg; }
+
     const std::unordered_map< std::size_t, std::size_t >& Filenodes() const
     { return m_filenodes; }
     std::unordered_map< std::size_t, std::size_t >& Filenodes()
@@ -137,6 +144,12 @@ class Discretization : public CBase_Discretization {
     Psup() const { return m_psup; }
     std::pair< std::vector< std::size_t >, std::vector< std::size_t > >&
     Psup() { return m_psup; }
+
+    const std::vector< std::size_t >& Spidx() const { return m_spidx; }
+    std::vector< std::size_t >& Spidx() { return m_spidx; }
+
+    const tk::Fields& GeoElemGrad() const { return m_geoElemGrad; }
+    tk::Fields& GeoElemGrad() { return m_geoElemGrad; }
     //@}
 
     //! Output chare element blocks to output file
@@ -145,22 +158,23 @@ class Discretization : public CBase_Discretization {
     //! Output mesh-based fields metadata to file
     void writeNodeMeta() const;
 
-    //! Output mesh-based element fields metadata to file
-    void writeElemMeta() const;
-
     //! Output solution to file
-    void writeNodeSolution( const tk::ExodusIIMeshWriter& ew,
-                        uint64_t it,
-                        const std::vector< std::vector< tk::real > >& u ) const;
     #ifdef HAS_ROOT
     void writeNodeSolution( const tk::RootMeshWriter& rmw,
                         uint64_t it,
                         const std::vector< std::vector< tk::real > >& u ) const;
     #endif
-    void writeElemSolution( const tk::ExodusIIMeshWriter& ew,
-                            uint64_t it,
-                            const std::vector< std::vector< tk::real > >& u )
-                          const;
+
+    //! Send solution to field output writer
+    void sendFields( uint64_t itf,
+                     tk::real time,
+                     const std::vector< std::vector< tk::real > >& u );
+
+    //! Receive notification that a field output has been written
+    void fieldsWritten();
+
+    //! Query if the worker must wait for field output in flight to be written
+    bool waitFields( bool flush, const CkCallback& resume );
 
     //! Set time step size
     void setdt( tk::real newdt );
@@ -183,6 +197,14 @@ class Discretization : public CBase_Discretization {
       p | m_nvol;
       p | m_outFilename;
       p | m_fct;
+      p | m_agg;
+      p | m_fieldwriter;
+      p | m_nchare;
+      p | m_writerPE;
+      p | m_nfieldpend;
+      p | m_fieldwait;
+      p | m_fieldflush;
+      p | m_fieldresume;
       p | m_transporter;
       p | m_bc;
       p | m_filenodes;
@@ -195,6 +217,8 @@ class Discretization : public CBase_Discretization {
       }
       p | m_coord;
       p | m_psup;
+      p | m_spidx;
+      p | m_geoElemGrad;
       p | m_msum;
       p | m_v;
       p | m_vol;
@@ -224,6 +248,22 @@ class Discretization : public CBase_Discretization {
     std::string m_outFilename;
     //! Distributed FCT proxy
     CProxy_DistFCT m_fct;
+    //! Message aggregator proxy
+    CProxy_Aggregator m_agg;
+    //! Asynchronous field output writer proxy
+    CProxy_FieldWriter m_fieldwriter;
+    //! Total number of Discretization chares
+    int m_nchare;
+    //! PE of the field writer all our field output is sent to
+    int m_writerPE;
+    //! Number of field outputs sent but not yet written
+    std::size_t m_nfieldpend;
+    //! True if the worker waits for field output to be written
+    bool m_fieldwait;
+    //! True if waiting for all field output to be written
+    bool m_fieldflush;
+    //! Callback to resume the worker once field output has been written
+    CkCallback m_fieldresume;
     //! Transporter proxy
     CProxy_Transporter m_transporter;
     //! Boundary conditions proxy
@@ -253,6 +293,12 @@ class Discretization : public CBase_Discretization {
     tk::UnsMesh::Coords m_coord;
     //! Points surrounding points of our chunk of the mesh
     std::pair< std::vector< std::size_t >, std::vector< std::size_t > > m_psup;
+    //! \brief Sparse matrix (psup1) indices of ordered node pairs of all
+    //!   elements of our chunk of the mesh, see tk::genSpidx()
+    std::vector< std::size_t > m_spidx;
+    //! \brief Element geometry (Jacobian, shape function derivatives,
+    //!   centroid) of our chunk of the mesh, see tk::genGeoElemTetGrad()
+    tk::Fields m_geoElemGrad;
     //! \brief Global mesh node IDs bordering the mesh chunk held by fellow
     //!   Discretization chares associated to their chare IDs
     //! \details msum: mesh chunks surrounding mesh chunks and their neighbor
@@ -281,6 +327,13 @@ class Discretization : public CBase_Discretization {
     //! Timer measuring a time step
     tk::Timer m_timer;
 
+    //! \brief Maximum number of field outputs in flight before the worker
+    //!   waits for them to be written
+    static constexpr std::size_t FIELD_BUFFERS = 2;
+
+    //! Query if field output in flight must be waited for
+    bool fieldsBusy() const;
+
     //! Sum mesh volumes to nodes, start communicating them on chare-boundaries
     void vol();
 
@@ -40,18 +40,15 @@
                tooltip="own contributions to the antidiffusive element
                         contributions computed"
                URL="\ref inciter::DistFCT::aec"];
-      ComAEC [ label="ComAEC"
-               tooltip="contributions to the antidiffusive element contributions
-                        communicated"
-               URL="\ref inciter::DistFCT::comaec"];
       OwnALW [ label="OwnALW"
                tooltip="own contributions to the maximum and minimum unknowns of
                         elements surrounding nodes computed"
                URL="\ref inciter::DistFCT::alw"];
-      ComALW [ label="ComALW"
-               tooltip="contributions to the the maximum and minimum unknowns of
-                        elements surrounding nodes communicated"
-               URL="\ref inciter::DistFCT::comalw"];
+      ComAECALW [ label="ComAECALW"
+               tooltip="contributions to the antidiffusive element contributions
+                        and the maximum and minimum unknowns of elements
+                        surrounding nodes communicated"
+               URL="\ref inciter::DistFCT::comaecalw"];
       Ver [ label="Ver" tooltip="verify antidiffusive element contributions"
             URL="\ref inciter::DistFCT::verify"];
       OwnLim [ label="OwnLim"
@@ -67,17 +64,13 @@
       OwnAEC -> Ver [ style="dashed" ];
       OwnALW -> Ver [ style="dashed" ];
       Upd -> OwnAEC [ style="solid" ];
-      Upd -> ComEC [ style="solid" ];
       LowUpd -> OwnALW [ style="solid" ];
-      LowUpd -> ComALW [ style="solid" ];
+      OwnAEC -> ComAECALW [ style="solid" ];
+      OwnALW -> ComAECALW [ style="solid" ];
       OwnAEC -> OwnLim [ style="solid" ];
-      ComAEC -> OwnLim [ style="solid" ];
       OwnALW -> OwnLim [ style="solid" ];
-      ComALW -> OwnLim [ style="solid" ];
-      OwnAEC -> ComLim [ style="solid" ];
-      ComAEC -> ComLim [ style="solid" ];
-      OwnALW -> ComLim [ style="solid" ];
-      ComALW -> ComLim [ style="solid" ];
+      ComAECALW -> OwnLim [ style="solid" ];
+      ComAECALW -> ComLim [ style="solid" ];
       OwnLim -> Apply [ style="solid" ];
       ComLim -> Apply [ style="solid" ];
     }
@@ -196,19 +189,16 @@ class DistFCT : public CBase_DistFCT {
     //! Prepare for next time step stage
     void next();
 
-    //! Receive sums of antidiffusive element contributions on chare-boundaries
-    void comaec( const std::vector< std::size_t >& gid,
-                 const std::vector< std::vector< tk::real > >& P );
-
-    //! \brief Receive contributions to the maxima and minima of unknowns of all
-    //!   elements surrounding mesh nodes on chare-boundaries
-    void comalw( const std::vector< std::size_t >& gid,
-                 const std::vector< std::vector< tk::real > >& Q );
+    //! \brief Receive sums of antidiffusive element contributions and
+    //!   contributions to the maxima and minima of unknowns of all elements
+    //!   surrounding mesh nodes on chare-boundaries
+    void comaecalw( const std::vector< std::size_t >& gid,
+                    const std::vector< tk::real >& PQ );
 
     //! \brief Receive contributions of limited antidiffusive element
     //!   contributions on chare-boundaries
     void comlim( const std::vector< std::size_t >& gid,
-                 const std::vector< std::vector< tk::real > >& A );
+                 const std::vector< tk::real >& A );
 
     //! Compute and sum antidiffusive element contributions (AEC) to mesh nodes
     void aec( const Discretization& d,
@@ -231,8 +221,7 @@ class DistFCT : public CBase_DistFCT {
       CBase_DistFCT::pup(p);
       p | m_nhsol;
       p | m_nlsol;
-      p | m_naec;
-      p | m_nalw;
+      p | m_naecalw;
       p | m_nlim;
       p | m_nchare;
       p | m_msum;
@@ -250,6 +239,7 @@ class DistFCT : public CBase_DistFCT {
       p | m_dul;
       p | m_du;
       p | m_scheme;
+      p | m_agg;
     }
     //! \brief Pack/Unpack serialize operator|
     //! \param[in,out] p Charm++'s PUP::er serializer object reference
@@ -267,11 +257,9 @@ class DistFCT : public CBase_DistFCT {
     //! Counter for low order solution nodes updated
     std::size_t m_nlsol;
     //! \brief Number of chares from which we received antidiffusive element
-    //!   contributions on chare boundaries
-    std::size_t m_naec;
-    //! \brief Number of chares from which we received maximum and minimum
-    //!   unknowns of elements surrounding nodes on chare boundaries
-    std::size_t m_nalw;
+    //!   contributions and maximum and minimum unknowns of elements
+    //!   surrounding nodes on chare boundaries
+    std::size_t m_naecalw;
     //! \brief Number of chares from which we received limited antidiffusion
     //!   element contributiones on chare boundaries
     std::size_t m_nlim;
@@ -305,11 +293,20 @@ class DistFCT : public CBase_DistFCT {
     tk::Fields m_ul, m_dul, m_du;
     //! Variant storing the discretization scheme class we interoperate with
     SchemeProxy m_scheme;
+    //! Message aggregator proxy
+    CProxy_Aggregator m_agg;
+
+    //! Query if chare-boundary messages are posted to the per-PE Aggregator
+    bool aggregate() const;
 
     //! \brief Verify antidiffusive element contributions up to linear solver
     //!   convergence
     void verify();
 
+    //! \brief Send antidiffusive element contributions and maximum and minimum
+    //!   unknowns of elements surrounding nodes on chare-boundaries
+    void aecalw();
+
     //! Compute the limited antidiffusive element contributions
     void lim();
 
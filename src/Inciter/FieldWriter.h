@@ -0,0 +1,168 @@
+// *****************************************************************************
+/*!
+  \file      src/Inciter/FieldWriter.h
+  \copyright 2016-2018, Los Alamos National Security, LLC.
+  \brief     Asynchronous mesh-based field output writer
+  \details   Asynchronous mesh-based field output writer.
+
+    Worker chares do not write ExodusII field output themselves. Instead, they
+    send their mesh chunk and, at every field output, a snapshot of their
+    fields to a branch of the FieldWriter group and continue time stepping
+    without waiting for the output to be written. The branch schedules the
+    actual file I/O at the lowest priority, so it runs only once the PE has
+    processed all messages already in its queue, i.e., I/O is overlapped with
+    the computation and communication of the worker chares. Once a snapshot
+    has been written, the sender is notified, see
+    Discretization::fieldsWritten(). Worker chares keep a bounded number of
+    snapshots in flight, see Discretization::waitFields(), which limits the
+    memory held by the writers.
+
+    By default every worker chare's output goes to its own ExodusII file,
+    written by the branch on the PE the chare resides on when it first sends
+    output. If a positive number of writers, N, is configured in the input
+    file, see kw::nwriter, worker chares are assigned to N writers in
+    contiguous blocks of chare IDs instead. Each writer merges the mesh chunks
+    it receives using global mesh node IDs, writes the merged mesh to a single
+    ExodusII file, and appends a time step to the same file once all of its
+    chares have sent their fields for that field output, thus N files are
+    written, each containing all time steps. Writers reside on N different PEs
+    spread evenly across all PEs.
+
+    Each output file is kept open by its writer after the mesh has been
+    written, so appending a time step does not reopen the file and reread its
+    metadata. Since a branch may write many files if output is not
+    aggregated, the number of files kept open per branch is bounded, see
+    FieldWriter::MAX_OPEN, closing the least recently written file first.
+    Files are not flushed after every write: a file is flushed to disk only
+    when it is closed, i.e., when it is evicted to stay within the bound, or
+    at the end of time stepping, see FieldWriter::close().
+*/
+// *****************************************************************************
+#ifndef FieldWriter_h
+#define FieldWriter_h
+
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+#include <unordered_map>
+
+#include "Types.h"
+#include "UnsMesh.h"
+#include "ExodusIIMeshWriter.h"
+
+#include "NoWarning/fieldwriter.decl.h"
+
+namespace inciter {
+
+//! FieldWriter Charm++ group writing mesh-based field output asynchronously
+class FieldWriter : public CBase_FieldWriter {
+
+  public:
+    //! Constructor
+    explicit FieldWriter();
+
+    //! Compute number of aggregating field writers
+    static int nwriter( int nchare );
+
+    //! Compute PE the field writer of a worker chare resides on
+    static int pe( int chare, int nchare );
+
+    //! Receive mesh chunk of a worker chare
+    void mesh( int chare,
+               int nchare,
+               const std::vector< std::size_t >& gid,
+               const std::vector< std::size_t >& inpoel,
+               const tk::UnsMesh::Coords& coord );
+
+    //! Receive fields of a worker chare
+    void fields( int chare,
+                 int nchare,
+                 uint64_t itf,
+                 tk::real time,
+                 const std::vector< std::vector< tk::real > >& u,
+                 CkCallback written );
+
+    //! Write output ready to be written
+    void write();
+
+    //! Close all output files held open by this branch
+    void close( CkCallback c );
+
+  private:
+    //! Snapshot of a field output of one or more worker chares
+    struct Dump {
+      //! Physical time
+      tk::real time;
+      //! Fields of the chares received so far associated to chare IDs
+      std::map< int, std::vector< std::vector< tk::real > > > u;
+      //! Callbacks to notify the chares once the fields have been written
+      std::vector< CkCallback > written;
+    };
+
+    //! Output file holding the output of one or more worker chares
+    struct File {
+      //! Output filename
+      std::string filename;
+      //! Number of worker chares whose output is written to this file
+      std::size_t nchunk = 0;
+      //! Global mesh node IDs of mesh chunks associated to chare IDs
+      std::map< int, std::vector< std::size_t > > gid;
+      //! Element connectivity (chunk-local IDs) of chunks associated to chares
+      std::map< int, std::vector< std::size_t > > inpoel;
+      //! Mesh node coordinates of mesh chunks associated to chare IDs
+      std::map< int, tk::UnsMesh::Coords > coord;
+      //! Map associating global mesh node IDs to node IDs in the file
+      std::unordered_map< std::size_t, std::size_t > lid;
+      //! True if the merged mesh has been written
+      bool meshWritten = false;
+      //! Snapshots buffered associated to field output iteration count
+      std::map< uint64_t, Dump > dump;
+      //! Number of field outputs written
+      uint64_t nwritten = 0;
+      //! ExodusII writer holding the file open, nullptr if closed
+      std::unique_ptr< tk::ExodusIIMeshWriter > writer;
+      //! Value of the write counter at the last write to this file
+      uint64_t used = 0;
+    };
+
+    //! Maximum number of files kept open by a branch
+    static constexpr std::size_t MAX_OPEN = 64;
+
+    //! Output files associated to file IDs (writer index or chare ID)
+    std::unordered_map< int, File > m_file;
+    //! True if a write has already been scheduled
+    bool m_write;
+    //! Number of writes performed by this branch
+    uint64_t m_nwrite;
+
+    //! Find or initialize output file of a worker chare
+    File& file( int chare, int nchare );
+
+    //! Schedule a write at the lowest priority if not yet scheduled
+    void schedule();
+
+    //! Return ExodusII writer of a file, opening the file if closed
+    tk::ExodusIIMeshWriter& handle( File& f, tk::ExoWriter mode );
+
+    //! Merge mesh chunks and write the merged mesh to file
+    void writeMesh( File& f );
+
+    //! Write a snapshot of fields to file
+    void writeFields( File& f, uint64_t itf, const Dump& d );
+
+    //! Query if a file's mesh is ready to be written
+    static bool meshReady( const File& f )
+    { return !f.meshWritten && f.gid.size() == f.nchunk; }
+
+    //! Query if a file's next snapshot is ready to be written
+    static bool fieldsReady( const File& f ) {
+      auto it = f.dump.find( f.nwritten + 1 );
+      return f.meshWritten && it != end(f.dump) &&
+             it->second.u.size() == f.nchunk;
+    }
+};
+
+} // inciter::
+
+#endif // FieldWriter_h
@@ -151,7 +151,7 @@ class MatCG : public CBase_MatCG {
     tk::Fields m_du;
     //! Unknown/solution vector increment (low order)
     tk::Fields m_dul;
-    //! Unknown/solution vector at mesh cells
+    //! Unknown/solution vector at mesh cells, empty if the rhs is fused
     tk::Fields m_ue;
     //! Sparse matrix sotring the diagonals and off-diagonals of nonzeros
     tk::Fields m_lhsd, m_lhso;
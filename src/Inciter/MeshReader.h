@@ -12,34 +12,51 @@
 
 #include <vector>
 #include <array>
+#include <map>
+#include <memory>
 
 #include "ExodusIIMeshReader.h"
+#include "NativeMeshReader.h"
 
 namespace inciter {
 
 //! Mesh reader class for inciter connecting to various readers
+//! \details The file type is detected from the file header. ExodusII files
+//!   are read via tk::ExodusIIMeshReader, while files in the native binary
+//!   format are read via tk::NativeMeshReader, which maps the file into memory
+//!   and thus reads the chunk of the mesh of a PE without parsing the file.
 class MeshReader {
 
   public:
     //! Constructor
-    //! \param[in] filename File to read mesh from
-    //! \param[in] npes Total number of PEs
-    //! \param[in] mype This PE
-    explicit MeshReader( const std::string& filename, int npes, int mype ) :
-      m_er( filename ),
-      m_npes( static_cast< std::size_t >( npes ) ),
-      m_mype( static_cast< std::size_t >( mype ) ) {}
+    explicit MeshReader( const std::string& filename, int npes, int mype );
 
     //! Read our chunk of the mesh graph (connectivity) from file
     void readGraph( std::vector< long >& gelemid,
                     std::vector< std::size_t >& ginpoel );
 
-    //! Read coordinates of a number of mesh nodes from ExodusII file
+    //! Read coordinates of a number of mesh nodes from file
     std::array< std::vector< tk::real >, 3 >
     readCoords( const std::vector< std::size_t > gid );
 
+    //! Return total number of mesh points in file
+    std::size_t npoin();
+
+    //! Read node list of all side sets from file
+    std::map< int, std::vector< std::size_t > > readSidesets();
+
+    //! Read face list of all side sets from file
+    std::size_t
+    readSidesetFaces( std::map< int, std::vector< std::size_t > >& bface );
+
+    //! Read face connectivity of a number of boundary faces from file
+    void readFaces( std::size_t nbfac, std::vector< std::size_t >& conn );
+
   private:
-    tk::ExodusIIMeshReader m_er;        //!< ExodusII mesh reader object
+    //! ExodusII mesh reader object (if file is ExodusII)
+    std::unique_ptr< tk::ExodusIIMeshReader > m_er;
+    //! Native mesh reader object (if file is native binary)
+    std::unique_ptr< tk::NativeMeshReader > m_nr;
     std::size_t m_npes;                 //!< Total number of PEs
     std::size_t m_mype;                 //!< This PE
 };
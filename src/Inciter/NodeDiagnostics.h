@@ -29,7 +29,9 @@ class NodeDiagnostics {
     static void registerReducers();
 
     //! Compute diagnostics, e.g., residuals, norms of errors, etc.
-    bool compute( Discretization& d, const tk::Fields& u );
+    bool compute( Discretization& d,
+                  const tk::Fields& u,
+                  const std::pair< std::size_t, tk::real >& linsys = {0,0.0} );
 
     ///@{
     //! \brief Pack/Unpack serialize member function
@@ -164,13 +164,33 @@ class Partitioner : public CBase_Partitioner {
     //!   (instead of assign) during reordering
     void gather();
 
-    //! \brief Query our global node IDs and edges by other PEs so they know if
-    //!   they are to receive IDs for those from during reordering
-    void query( int p, const std::vector< std::size_t >& nodes );
+    //! \brief Register chare-boundary nodes of a PE in the portion of the
+    //!   distributed node directory owned by our PE
+    void query( int p,
+                const std::unordered_map< std::size_t,
+                                          std::vector< int > >& bnodechares );
+
+    //! \brief Receive number of PEs registering chare-boundary nodes in the
+    //!   portion of the distributed node directory owned by our PE
+    void expect( int* nreg, std::size_t n );
 
     //! Receive mask of to-be-received global mesh node IDs
-    void mask( int p, const std::unordered_map< std::size_t,
-                              std::vector< int > >& cn );
+    void mask( const std::unordered_map< int,
+                 std::unordered_map< std::size_t, std::vector< int > > >& cn );
+
+    //! \brief Register chare-boundary faces of a PE in the portion of the
+    //!   distributed face directory owned by our PE
+    void regface( int p, const std::vector< std::size_t >& f );
+
+    //! \brief Receive number of PEs registering faces in the portion of the
+    //!   distributed face directory owned by our PE
+    void expectface( int* nreg, std::size_t n );
+
+    //! Receive face-neighbor elements of our elements held by other PEs
+    void adjface( const std::vector< std::size_t >& a );
+
+    //! Receive chare IDs of face-neighbor elements held by other PEs
+    void adjchare( int p, const std::vector< std::size_t >& c );
 
     //! Create worker chare array elements on this PE
     void createWorkers();
@@ -186,6 +206,7 @@ class Partitioner : public CBase_Partitioner {
       , tag::avecost,     CkCallback
       , tag::stdcost,     CkCallback
       , tag::coord,       CkCallback
+      , tag::edgecut,     CkCallback
     > m_cb;
     //! Host proxy
     CProxy_Transporter m_host;
@@ -210,16 +231,34 @@ class Partitioner : public CBase_Partitioner {
     //!   reordering later
     std::size_t m_noffset;
     //! \brief Counter for number of queries for global mesh node IDs
-    //! \details This counts the number of queries received while
-    //!   gathering the node IDs that need to be received (instead of uniquely
-    //!   assigned) by each PE
+    //! \details This counts the number of PEs that have registered their
+    //!   chare-boundary nodes in the portion of the distributed node directory
+    //!   owned by our PE while gathering the node IDs that need to be received
+    //!   (instead of uniquely assigned) by each PE
     std::size_t m_nquery;
+    //! \brief Number of PEs expected to register chare-boundary nodes in the
+    //!   portion of the distributed node directory owned by our PE
+    //! \details Unknown, i.e., std::numeric_limits< std::size_t >::max(),
+    //!   until received by expect()
+    std::size_t m_nreg;
     //! \brief Counter for number of masks of to-be-received global mesh node
     //!   IDs received
     //! \details This counts the to-be-received node ID masks received while
     //!   gathering the node IDs that need to be received (instead of uniquely
     //!   assigned) by each PE
     std::size_t m_nmask;
+    //! \brief Number of PEs owning the portions of the distributed node
+    //!   directory in which we registered chare-boundary nodes, i.e., the
+    //!   number of masks we expect
+    std::size_t m_nowner;
+    //! \brief Portion of the distributed node directory owned by our PE
+    //! \details The distributed directory associates chare-boundary nodes to
+    //!   the PEs (inner map key) and their chares (inner map value) that
+    //!   contribute to them. The directory is partitioned across PEs so that
+    //!   a global mesh node ID (outer map key) is registered on PE = ID modulo
+    //!   the number of PEs.
+    std::unordered_map< std::size_t, std::map< int, std::vector< int > > >
+      m_dir;
     //! Tetrtahedron element connectivity of our chunk of the mesh
     std::vector< std::size_t > m_tetinpoel;
     //! Global element IDs we read (our chunk of the mesh)
@@ -228,6 +267,46 @@ class Partitioner : public CBase_Partitioner {
     std::array< std::vector< tk::real >, 3 > m_coord;
     //! Element centroid coordinates of our chunk of the mesh
     std::array< std::vector< tk::real >, 3 > m_centroid;
+    //! \brief Elements surrounding elements of our chunk of the mesh (local
+    //!   element IDs, -1 if the face-neighbor is not on our PE)
+    std::vector< int > m_esuel;
+    //! \brief Face-neighbor elements of our elements held by other PEs
+    //! \details Associates, to a fellow PE (map key), a list of our local
+    //!   element ID, the neighbor's local element ID on the fellow PE, and the
+    //!   neighbor's global element ID.
+    std::unordered_map< int, std::vector< std::array< std::size_t, 3 > > >
+      m_remadj;
+    //! \brief Portion of the distributed face directory owned by our PE
+    //! \details The distributed directory associates faces (given by global
+    //!   node IDs) on the boundary of the chunks of the mesh read by PEs to
+    //!   the PE, local element ID, and global element ID of the elements they
+    //!   bound. A face is registered on PE = lowest node ID of the face modulo
+    //!   the number of PEs.
+    std::unordered_map< tk::UnsMesh::Face,
+                        std::vector< std::array< std::size_t, 3 > >,
+                        tk::UnsMesh::FaceHasher,
+                        tk::UnsMesh::FaceEq > m_fdir;
+    //! \brief Counter for number of PEs that have registered faces in the
+    //!   portion of the distributed face directory owned by our PE
+    std::size_t m_nfreg;
+    //! \brief Number of PEs expected to register faces in the portion of the
+    //!   distributed face directory owned by our PE
+    //! \details Unknown, i.e., std::numeric_limits< std::size_t >::max(),
+    //!   until received by expectface()
+    std::size_t m_nfexp;
+    //! Counter for number of answers received from face directory owner PEs
+    std::size_t m_nfadj;
+    //! \brief Number of PEs owning the portions of the distributed face
+    //!   directory in which we registered faces, i.e., the number of answers
+    //!   we expect
+    std::size_t m_nfowner;
+    //! Chare IDs assigned to our elements by the mesh partitioner
+    std::vector< std::size_t > m_che;
+    //! \brief Our local element IDs and the chare IDs of their face-neighbors
+    //!   held by higher PEs
+    std::vector< std::array< std::size_t, 2 > > m_adjche;
+    //! Counter for number of chare IDs messages from PEs holding face-neighbors
+    std::size_t m_nadjche;
     //! Total number of chares across all PEs
     int m_nchare;
     //! Lower bound of node IDs our PE operates on after reordering
@@ -337,6 +416,16 @@ class Partitioner : public CBase_Partitioner {
     void computeCentroids(
       const std::unordered_map< std::size_t, std::size_t >& lid );
 
+    //! Compute the element dual graph of our chunk of the mesh
+    void dualGraph( const std::vector< std::size_t >& inpoel );
+
+    //! \brief Answer all PEs that registered faces in our portion of the
+    //!   distributed face directory
+    void answerface();
+
+    //! Compute edge cut of the mesh partition and distribute mesh
+    void edgecut();
+
     //! Construct global mesh node ids for each chare
     std::unordered_map< int, std::vector< std::size_t > >
     chareNodes( const std::vector< std::size_t >& che ) const;
@@ -366,6 +455,14 @@ class Partitioner : public CBase_Partitioner {
     //! Compute final result of reordering
     void reordered();
 
+    //! \brief Answer all PEs that registered chare-boundary nodes in our portion
+    //!   of the distributed node directory
+    void answer();
+
+    //! \brief Compute node communication maps once all masks of to-be-received
+    //!   global mesh node IDs have been received
+    void masked();
+
     //! Compute lower and upper bounds of reordered node IDs our PE operates on
     void bounds();
 
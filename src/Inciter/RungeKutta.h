@@ -0,0 +1,55 @@
+// *****************************************************************************
+/*!
+  \file      src/Inciter/RungeKutta.h
+  \copyright 2016-2018, Los Alamos National Security, LLC.
+  \brief     Coefficients of explicit strong-stability-preserving Runge-Kutta
+    time integration schemes
+  \details   Coefficients of explicit strong-stability-preserving (SSP)
+    Runge-Kutta (RK) time integration schemes in Shu-Osher form. Stage s of a
+    scheme with the number of stages given by
+    inciter::ctr::TimeIntegration::nstage() computes
+
+    u^{s+1} = a_s u^n + b_s [ u^s + dt L(u^s, t^n + c_s dt) ],
+
+    where u^0 = u^n is the solution at the beginning of the time step, L is the
+    spatial operator, and the solution at the end of the time step is given by
+    the last stage. The first stage is always a forward Euler step. References:
+    C.-W. Shu, S. Osher, Efficient implementation of essentially
+    non-oscillatory shock-capturing schemes, J. Comput. Phys. 77, 1988;
+    S. Gottlieb, C.-W. Shu, Total variation diminishing Runge-Kutta schemes,
+    Math. Comput. 67, 1998.
+*/
+// *****************************************************************************
+#ifndef RungeKutta_h
+#define RungeKutta_h
+
+#include <array>
+
+#include "Types.h"
+
+namespace inciter {
+
+//! Weights of the solution at the beginning of the time step, a_s, for 1, 2,
+//!   and 3 stages, indexed by [number of stages - 1][stage]
+const std::array< std::array< tk::real, 3 >, 3 >
+  rkcoef_a{{ {{ 0.0, 0.0, 0.0 }},
+             {{ 0.0, 1.0/2.0, 0.0 }},
+             {{ 0.0, 3.0/4.0, 1.0/3.0 }} }};
+
+//! Weights of the forward Euler step from the previous stage, b_s, for 1, 2,
+//!   and 3 stages, indexed by [number of stages - 1][stage]
+const std::array< std::array< tk::real, 3 >, 3 >
+  rkcoef_b{{ {{ 1.0, 0.0, 0.0 }},
+             {{ 1.0, 1.0/2.0, 0.0 }},
+             {{ 1.0, 1.0/4.0, 2.0/3.0 }} }};
+
+//! Fraction of the time step at which stages evaluate the spatial operator,
+//!   c_s, for 1, 2, and 3 stages, indexed by [number of stages - 1][stage]
+const std::array< std::array< tk::real, 3 >, 3 >
+  rkcoef_c{{ {{ 0.0, 0.0, 0.0 }},
+             {{ 0.0, 1.0, 0.0 }},
+             {{ 0.0, 1.0, 1.0/2.0 }} }};
+
+} // inciter::
+
+#endif // RungeKutta_h
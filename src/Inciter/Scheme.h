@@ -218,7 +218,8 @@ class Scheme : public SchemeBase {
     //!   using the last argument as default.
     template< typename... Args >
     void discInsert( const CkArrayIndex1D& x, Args&&... args ) {
-      discproxy[x].insert( fctproxy, std::forward<Args>(args)... );
+      discproxy[x].insert( fctproxy, aggproxy, fieldwriter,
+                           std::forward<Args>(args)... );
     }
 
     //////  discproxy.doneInserting(...)
@@ -23,6 +23,8 @@
 #include "NoWarning/matcg.decl.h"
 #include "NoWarning/diagcg.decl.h"
 #include "NoWarning/distfct.decl.h"
+#include "NoWarning/aggregator.decl.h"
+#include "NoWarning/fieldwriter.decl.h"
 #include "NoWarning/dg.decl.h"
 #include "NoWarning/discretization.decl.h"
 
@@ -42,7 +44,8 @@ class SchemeBase {
     //!    specific to a given discretization. Note that proxy is bound (in
     //!    migration behavior and properties) to discproxy.
     explicit SchemeBase( ctr::SchemeType scheme ) :
-      discproxy( CProxy_Discretization::ckNew() )
+      discproxy( CProxy_Discretization::ckNew() ),
+      fieldwriter( CProxy_FieldWriter::ckNew() )
     {
       CkArrayOptions bound;
       bound.bindTo( discproxy );
@@ -50,8 +53,10 @@ class SchemeBase {
         proxy = static_cast< CProxy_MatCG >( CProxy_MatCG::ckNew(bound) );
         fctproxy = CProxy_DistFCT::ckNew(bound);
       } else if (scheme == ctr::SchemeType::DiagCG) {
-        proxy = static_cast< CProxy_DiagCG >( CProxy_DiagCG::ckNew(bound) );
+        auto p = CProxy_DiagCG::ckNew(bound);
+        proxy = static_cast< CProxy_DiagCG >( p );
         fctproxy= CProxy_DistFCT::ckNew(bound);
+        aggproxy = CProxy_Aggregator::ckNew( p, fctproxy );
       } else if (scheme == ctr::SchemeType::DG) {
         proxy = static_cast< CProxy_DG >( CProxy_DG::ckNew(bound) );
       } else Throw( "Unknown discretization scheme" );
@@ -60,6 +65,9 @@ class SchemeBase {
     //! Get reference to discretization proxy
     CProxy_Discretization& get() noexcept { return discproxy; }
 
+    //! Get reference to asynchronous field output writer proxy
+    CProxy_FieldWriter& fieldWriter() noexcept { return fieldwriter; }
+
     //! Query underlying proxy type
     //! \return Zero-based index into the set of types of Proxy
     int which() const noexcept { return proxy.which(); }
@@ -84,6 +92,10 @@ class SchemeBase {
     CProxy_Discretization discproxy;
     //! Charm++ proxy to flux-corrected transport (FCT) driver class
     CProxy_DistFCT fctproxy;
+    //! Charm++ proxy to per-PE message aggregator (used only by DiagCG)
+    CProxy_Aggregator aggproxy;
+    //! Charm++ proxy to asynchronous field output writer
+    CProxy_FieldWriter fieldwriter;
 
     //! Generic base for all call_* classes
     //! \details This class stores the entry method arguments and contains a
@@ -143,6 +155,8 @@ class SchemeBase {
       p | proxy;
       p | discproxy;
       p | fctproxy;
+      p | aggproxy;
+      p | fieldwriter;
     }
     //! \brief Pack/Unpack serialize operator|
     //! \param[in,out] p Charm++'s PUP::er serializer object reference
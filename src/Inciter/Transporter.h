@@ -417,6 +417,9 @@ class Transporter : public CBase_Transporter {
     //!   for computing the communication maps required for node ID reordering
     void flattened();
 
+    //! Reduction target collecting the edge cut of the mesh partition
+    void edgecut( unsigned long long cut );
+
     //! Reduction target estimating the average communication cost among all PEs
     void aveCost( tk::real c );
 
@@ -493,6 +496,10 @@ class Transporter : public CBase_Transporter {
     //! Normal finish of time stepping
     void finish();
 
+    //! \brief Reduction target indicating that all field output files have
+    //!   been closed
+    void closed();
+
   private:
     InciterPrint m_print;                //!< Pretty printer
     int m_nchare;                        //!< Number of worker chares
@@ -505,6 +512,8 @@ class Transporter : public CBase_Transporter {
     CProxy_Partitioner m_partitioner;    //!< Partitioner group proxy
     //! Average communication cost of merging the linear system
     tk::real m_avcost;
+    //! Number of faces shared by elements assigned to different chares
+    unsigned long long m_edgecut;
      //! Total mesh volume
     tk::real m_V;
     //! Total number of mesh nodes
@@ -0,0 +1,81 @@
+// *****************************************************************************
+/*!
+  \file      src/LinSys/DistCSR.h
+  \copyright 2012-2015, J. Bakosi, 2016-2018, Los Alamos National Security, LLC.
+  \brief     Compressed sparse row storage of a PE's part of a matrix
+  \details   Compressed sparse row (CSR) storage of the rows of a distributed
+    matrix owned by a processing element (PE), used by the native Krylov
+    solvers in Solver. The rows are split into a diagonal block, whose columns
+    are owned by this PE, and an off-diagonal block, whose columns are owned by
+    fellow PEs (ghosts). This allows overlapping the product with the diagonal
+    block with the communication of the ghost values. Each nonzero stores a
+    value for each scalar component of the system, since the systems of
+    different components share the sparsity pattern but are otherwise
+    independent.
+*/
+// *****************************************************************************
+#ifndef DistCSR_h
+#define DistCSR_h
+
+#include <vector>
+#include <map>
+
+#include "Types.h"
+#include "Options/Preconditioner.h"
+
+namespace tk {
+
+//! Compressed sparse row storage of a PE's part of a distributed matrix
+class DistCSR {
+
+  public:
+    //! Empty constructor
+    explicit DistCSR() = default;
+
+    //! Constructor: convert matrix rows owned to CSR
+    explicit DistCSR( std::size_t ncomp,
+                      std::size_t lower,
+                      std::size_t upper,
+                      const std::map< std::size_t,
+                              std::map< std::size_t,
+                                        std::vector< tk::real > > >& A );
+
+    //! Global column (row) IDs of ghosts, sorted
+    const std::vector< std::size_t >& ghost() const noexcept { return m_ghost; }
+
+    //! Multiply vector with the diagonal block: y = A_diag x
+    void multdiag( const std::vector< tk::real >& x,
+                   std::vector< tk::real >& y ) const;
+
+    //! Add product of ghost vector with the off-diagonal block: y += A_offd g
+    void multoffd( const std::vector< tk::real >& g,
+                   std::vector< tk::real >& y ) const;
+
+    //! Setup preconditioner
+    void precond( tk::ctr::PreconditionerType pc );
+
+    //! Apply preconditioner: z = M^{-1} r
+    void apply( const std::vector< tk::real >& r,
+                std::vector< tk::real >& z ) const;
+
+  private:
+    std::size_t m_ncomp = 0;            //!< Number of scalar components
+    std::size_t m_nrow = 0;             //!< Number of rows owned
+    //! Preconditioner type
+    tk::ctr::PreconditionerType m_pc = tk::ctr::PreconditionerType::NONE;
+    std::vector< std::size_t > m_ghost; //!< Sorted global IDs of ghosts
+    std::vector< std::size_t > m_dia;   //!< Row pointers of diagonal block
+    std::vector< std::size_t > m_dja;   //!< Local column IDs of diagonal block
+    std::vector< tk::real > m_da;       //!< Values of diagonal block
+    std::vector< std::size_t > m_diag;  //!< Position of the diagonal in m_dja
+    std::vector< std::size_t > m_oia;   //!< Row pointers of off-diagonal block
+    std::vector< std::size_t > m_oja;   //!< Ghost IDs of off-diagonal block
+    std::vector< tk::real > m_oa;       //!< Values of off-diagonal block
+    //! Preconditioner data: inverse of the diagonal for Jacobi, incomplete LU
+    //! factors of the diagonal block (in the layout of m_da) for ILU(0)
+    std::vector< tk::real > m_m;
+};
+
+} // tk::
+
+#endif // DistCSR_h
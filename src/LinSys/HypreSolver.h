@@ -15,6 +15,11 @@
 
 #include <HYPRE.h>
 #include "NoWarning/HYPRE_krylov.h"
+#include "NoWarning/HYPRE_parcsr_ls.h"
+
+#include "Types.h"
+#include "Exception.h"
+#include "Options/Preconditioner.h"
 
 namespace tk {
 namespace hypre {
@@ -29,42 +34,109 @@ class HypreSolver {
     #endif
 
     //! Create and initialize Hypre solver
-    void create( ) {
+    //! \param[in] pc Preconditioner type
+    //! \param[in] ncomp Number of scalar components per mesh node, whose
+    //!   unknowns are interleaved in the linear system
+    //! \param[in] tol Convergence tolerance relative to the norm of the rhs
+    //! \param[in] maxit Maximum number of iterations
+    void create( tk::ctr::PreconditionerType pc,
+                 std::size_t ncomp,
+                 tk::real tol,
+                 std::size_t maxit )
+    {
       // Create Hypre solver
       HYPRE_ParCSRPCGCreate( MPI_COMM_WORLD, &m_solver );
       // Set solver parameters, see Hypre manual for more
-      HYPRE_PCGSetMaxIter( m_solver, 1000 ); // max iterations
-      HYPRE_PCGSetTol( m_solver, 1.0e-14 );  // conv. tolerance
+      HYPRE_PCGSetMaxIter( m_solver, static_cast<int>(maxit) ); // max iter
+      HYPRE_PCGSetTol( m_solver, tol );                         // conv. tol
       HYPRE_PCGSetTwoNorm( m_solver, 1 );    // use 2-norm as stopping criteria
       HYPRE_PCGSetPrintLevel( m_solver, 1 ); // print out iteration info
       HYPRE_PCGSetLogging( m_solver, 1 );    // for run info
+      // Create and attach preconditioner
+      m_pc = pc;
+      if (pc == tk::ctr::PreconditionerType::JACOBI) {
+        HYPRE_PCGSetPrecond( m_solver,
+          (HYPRE_PtrToSolverFcn) HYPRE_ParCSRDiagScale,
+          (HYPRE_PtrToSolverFcn) HYPRE_ParCSRDiagScaleSetup, nullptr );
+      } else if (pc == tk::ctr::PreconditionerType::ILU0) {
+        HYPRE_EuclidCreate( MPI_COMM_WORLD, &m_precond );
+        HYPRE_EuclidSetLevel( m_precond, 0 );   // ILU(0)
+        HYPRE_PCGSetPrecond( m_solver,
+          (HYPRE_PtrToSolverFcn) HYPRE_EuclidSolve,
+          (HYPRE_PtrToSolverFcn) HYPRE_EuclidSetup, m_precond );
+      } else if (pc == tk::ctr::PreconditionerType::AMG) {
+        HYPRE_BoomerAMGCreate( &m_precond );
+        HYPRE_BoomerAMGSetTol( m_precond, 0.0 );      // one V-cycle per apply
+        HYPRE_BoomerAMGSetMaxIter( m_precond, 1 );
+        HYPRE_BoomerAMGSetPrintLevel( m_precond, 0 );
+        HYPRE_BoomerAMGSetNumFunctions( m_precond, static_cast<int>(ncomp) );
+        HYPRE_PCGSetPrecond( m_solver,
+          (HYPRE_PtrToSolverFcn) HYPRE_BoomerAMGSolve,
+          (HYPRE_PtrToSolverFcn) HYPRE_BoomerAMGSetup, m_precond );
+      } else if (pc == tk::ctr::PreconditionerType::PARASAILS) {
+        HYPRE_ParaSailsCreate( MPI_COMM_WORLD, &m_precond );
+        HYPRE_ParaSailsSetSym( m_precond, 1 );  // symmetric positive definite
+        HYPRE_PCGSetPrecond( m_solver,
+          (HYPRE_PtrToSolverFcn) HYPRE_ParaSailsSolve,
+          (HYPRE_PtrToSolverFcn) HYPRE_ParaSailsSetup, m_precond );
+      }
     }
 
     #if defined(__clang__)
       #pragma clang diagnostic pop
     #endif
 
+    //! Flag the solver to be set up again before the next solve
+    //! \details Must be called after the values of the matrix change.
+    void reset() noexcept { m_setup = false; }
+
     //! Solve the linear system
+    //! \details The solver is set up only at the first solve after create()
+    //!   or reset(), since the setup only depends on the matrix.
     void solve( const HypreMatrix& A,
                 const HypreVector& b,
-                const HypreVector& x ) const
+                const HypreVector& x )
     {
-      HYPRE_ParCSRPCGSetup( m_solver, A.get(), b.get(), x.get() );
-      HYPRE_ParCSRPCGSolve( m_solver, A.get(), b.get(), x.get() );
-      if (CkMyPe() == 0) {
-        int niter;
-        HYPRE_PCGGetNumIterations( m_solver, &niter );
-        double resnorm;
-        HYPRE_PCGGetFinalRelativeResidualNorm( m_solver, &resnorm );
-        //std::cout << "it = " << niter << ", norm = " << resnorm << std::endl;
+      if (!m_setup) {
+        HYPRE_ParCSRPCGSetup( m_solver, A.get(), b.get(), x.get() );
+        m_setup = true;
       }
+      HYPRE_ParCSRPCGSolve( m_solver, A.get(), b.get(), x.get() );
     }
 
-    //! \brief Destructor: destroy Hypre solver
-    ~HypreSolver() noexcept { HYPRE_ParCSRPCGDestroy( m_solver ); }
+    //! Query number of iterations taken by the last solve
+    //! \return Number of iterations of the last solve
+    std::size_t iterations() const {
+      int niter = 0;
+      HYPRE_PCGGetNumIterations( m_solver, &niter );
+      return static_cast< std::size_t >( niter );
+    }
+
+    //! Query final relative residual norm of the last solve
+    //! \return Final relative residual norm of the last solve
+    tk::real residual() const {
+      double resnorm = 0.0;
+      HYPRE_PCGGetFinalRelativeResidualNorm( m_solver, &resnorm );
+      return resnorm;
+    }
+
+    //! \brief Destructor: destroy Hypre solver and preconditioner
+    ~HypreSolver() noexcept {
+      HYPRE_ParCSRPCGDestroy( m_solver );
+      if (m_pc == tk::ctr::PreconditionerType::ILU0)
+        HYPRE_EuclidDestroy( m_precond );
+      else if (m_pc == tk::ctr::PreconditionerType::AMG)
+        HYPRE_BoomerAMGDestroy( m_precond );
+      else if (m_pc == tk::ctr::PreconditionerType::PARASAILS)
+        HYPRE_ParaSailsDestroy( m_precond );
+    }
 
   private:
     HYPRE_Solver m_solver;      //!< Hypre solver
+    HYPRE_Solver m_precond;     //!< Hypre preconditioner (if any)
+    //! Preconditioner type
+    tk::ctr::PreconditionerType m_pc = tk::ctr::PreconditionerType::NONE;
+    bool m_setup = false;       //!< True if solver has been set up
 };
 
 } // hypre::
@@ -7,8 +7,11 @@
     assemble the left hand side matrix (lhs), the right hand side (rhs) vector,
     and the solution (unknown) vector from individual worker
     chares. Beside collection and assembly, the system is also solved. The
-    solution is outsourced to hypre, an MPI-only library. Once the solution is
-    available, the individual worker chares are updated with the new solution.
+    solution is outsourced to hypre, an MPI-only library, or, if configured
+    by the user, is done by native distributed preconditioned conjugate
+    gradients (CG) or restarted GMRES Krylov solvers, see DistCSR. Once the
+    solution is available, the individual worker chares are updated with the
+    new solution.
 
     This class assembles and solves two linear systems, whose rhs vectors may
     change during time stepping. One of the two linear systems is called a
@@ -165,6 +168,9 @@
 #include "HypreMatrix.h"
 #include "HypreVector.h"
 #include "HypreSolver.h"
+#include "DistCSR.h"
+#include "Options/LinearSolver.h"
+#include "Options/Preconditioner.h"
 
 #include "NoWarning/solver.decl.h"
 #include "NoWarning/matcg.decl.h"
@@ -214,7 +220,11 @@ class Solver : public CBase_Solver {
     Solver( CProxy_SolverShadow sh,
             const std::vector< CkCallback >& cb,
             std::size_t n,
-            bool /*feedback*/ );
+            bool /*feedback*/,
+            tk::ctr::LinearSolverType linsolver,
+            tk::ctr::PreconditionerType precond,
+            tk::real tol,
+            std::size_t maxit );
 
     //! Configure Charm++ reduction types for concatenating BC nodelists
     static void registerReducers();
@@ -299,6 +309,15 @@ class Solver : public CBase_Solver {
     //! All communications have been establised among PEs
     void comfinal();
 
+    //! Receive request for matrix halo (ghost) values from fellow PE
+    void reqhalo( int frompe, const std::vector< std::size_t >& row );
+
+    //! Receive matrix halo (ghost) vector values from fellow PE
+    void comhalo( int frompe, const std::vector< tk::real >& v );
+
+    //! Reduction target collecting global sums for the native Krylov solvers
+    void krylov( tk::real* d, std::size_t n );
+
     //! Chares query Dirichlet boundary conditions
     //! \note This function does not have to be declared as a Charm++ entry
     //!   method since it is always called by chares on the same PE.
@@ -306,6 +325,13 @@ class Solver : public CBase_Solver {
             std::vector< std::pair< bool, tk::real > > >&
       dirbc() { return m_bc; }
 
+    //! \brief Chares query the number of iterations and the final relative
+    //!   residual of the last linear solve
+    //! \note This function does not have to be declared as a Charm++ entry
+    //!   method since it is always called by chares on the same PE.
+    std::pair< std::size_t, tk::real > linsys() const
+    { return { m_linit, m_linres }; }
+
     //! \brief Chares contribute their global row ids and associated Dirichlet
     //!   boundary condition values at which they set BCs
     void charebc( const std::unordered_map< std::size_t,
@@ -335,6 +361,14 @@ class Solver : public CBase_Solver {
     int pe( std::size_t gid );
 
   private:
+    //! Stages of the native Krylov solvers waiting on matvec or reduction
+    enum class KrylovStage : uint8_t { CG_INIT
+                                     , CG_PQ
+                                     , CG_RZ
+                                     , GMRES_INIT
+                                     , GMRES_ARNOLDI
+                                     , GMRES_NORM };
+
     CProxy_SolverShadow m_shadow;
     //! Charm++ reduction callbacks associated to compile-time tags
     tk::tuple::tagged_tuple<
@@ -411,6 +445,12 @@ class Solver : public CBase_Solver {
     std::vector< int > m_hypreCols;
     //! Matrix nonzero values for my PE
     std::vector< tk::real > m_hypreMat;
+    //! True if the matrix nonzero values changed since last set in Hypre
+    bool m_lhschanged;
+    //! Number of iterations taken by the last linear solve
+    std::size_t m_linit;
+    //! Final relative residual norm of the last linear solve
+    tk::real m_linres;
     //! RHS vector nonzero values for my PE
     std::vector< tk::real > m_hypreRhs;
     //! Solution vector nonzero values for my PE
@@ -444,6 +484,47 @@ class Solver : public CBase_Solver {
                         std::map< std::size_t, std::vector<tk::real> > > m_bca;
     //! Worker proxy
     inciter::CProxy_MatCG m_worker;
+    //! Linear solver selected
+    tk::ctr::LinearSolverType m_linsolver;
+    //! Preconditioner selected for the native Krylov solvers
+    tk::ctr::PreconditionerType m_precond;
+    //! Convergence tolerance relative to the norm of the right-hand side
+    tk::real m_tol;
+    //! Maximum number of linear solver iterations
+    std::size_t m_maxit;
+    //! Our PE's part of the matrix in CSR format for the native solvers
+    DistCSR m_csr;
+    //! True if m_csr has been built
+    bool m_csrbuilt;
+    //! Global row IDs of ghosts (matrix halo) associated to their owner PEs
+    std::map< int, std::vector< std::size_t > > m_haloimp;
+    //! Offsets of ghosts of owner PEs into the ghost vector, see DistCSR
+    std::map< int, std::size_t > m_halooff;
+    //! Local row IDs we send as halo values associated to requesting PEs
+    std::map< int, std::vector< std::size_t > > m_haloexp;
+    //! Ghost vector values received in a matrix-vector product
+    std::vector< tk::real > m_ghost;
+    //! Number of fellow PEs whose halo values have been received
+    std::size_t m_nhalo;
+    //! True if our own part of a matrix-vector product is done
+    bool m_ownmv;
+    //! Native Krylov solver stage waiting on matvec or reduction
+    KrylovStage m_stage;
+    //! Native Krylov solver iteration count
+    std::size_t m_kit;
+    //! Inner (Arnoldi) iteration count in a GMRES restart cycle
+    std::size_t m_kj;
+    //! Norm of the right-hand side (for each scalar component)
+    std::vector< tk::real > m_bnorm;
+    //! CG: r.z for each scalar component
+    std::vector< tk::real > m_rho;
+    //! Krylov solver work vectors: residual, preconditioned residual, search
+    //! direction, and matrix-vector product
+    std::vector< tk::real > m_r, m_z, m_p, m_q;
+    //! GMRES: orthonormal Krylov basis and its preconditioned counterpart
+    std::vector< std::vector< tk::real > > m_V, m_Z;
+    //! GMRES: Hessenberg matrix, Givens rotations, and rotated residual
+    std::vector< tk::real > m_H, m_cs, m_sn, m_g;
 
     //! Check if we have done our part in storing and exporting global row ids
     bool comcomplete() const;
@@ -502,6 +583,41 @@ class Solver : public CBase_Solver {
     //! Update solution vector in our PE's workers
     void updateSol();
 
+    //! Query if a native Krylov solver is used instead of Hypre
+    bool native() const
+    { return m_linsolver != tk::ctr::LinearSolverType::HYPRE; }
+
+    //! Build CSR matrix and request halo values for the native solvers
+    void csr();
+
+    //! Start a distributed matrix-vector product with our PE's part of matrix
+    void matvec( const std::vector< tk::real >& v );
+
+    //! Finish distributed matrix-vector product and continue Krylov solver
+    void mvdone();
+
+    //! Contribute to global sums for the native Krylov solvers
+    void reduce( const std::vector< tk::real >& d );
+
+    //! Compute our PE's partial dot products (for each scalar component)
+    std::vector< tk::real > dot( const std::vector< tk::real >& a,
+                                 const std::vector< tk::real >& b ) const;
+
+    //! Finish native Krylov solve: record statistics and update workers
+    void krylovDone( const tk::real* rr );
+
+    //! Query if all scalar components of the native solve have converged
+    bool converged( const tk::real* rr ) const;
+
+    //! Warn if the last solve stopped at the iteration limit unconverged
+    void checkConverged() const;
+
+    //! Start next Arnoldi iteration of the native GMRES solver
+    void arnoldi();
+
+    //! Update native GMRES solution at the end of a restart cycle
+    void gmresUpdate();
+
     //! Solve hyigh-order linear system
     void solve();
 
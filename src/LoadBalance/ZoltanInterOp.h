@@ -33,6 +33,16 @@ geomPartMesh( tk::ctr::PartitioningAlgorithmType algorithm,
               std::size_t nelem,
               int npart );
 
+//! \brief Partition mesh using Zoltan2 with a graph partitioner operating on
+//!   the mesh element dual graph
+std::vector< std::size_t >
+graphPartMesh( tk::ctr::PartitioningAlgorithmType algorithm,
+               const std::vector< long >& elemid,
+               const std::vector< std::size_t >& xadj,
+               const std::vector< long >& adjncy,
+               const std::vector< tk::real >& elemwgt,
+               int npart );
+
 } // zoltan::
 } // tk::
 
@@ -32,6 +32,7 @@ class MeshConvDriver {
   private:
     const tk::Print& m_print;           //!< Pretty printer
     const bool m_reorder;               //!< Whether to also reorder mesh nodes
+    const bool m_derived;               //!< Whether to also store derived data
     std::string m_input;                //!< Input file name
     std::string m_output;               //!< Output file name
 };
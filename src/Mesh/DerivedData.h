@@ -47,6 +47,13 @@ genPsup( const std::vector< std::size_t >& inpoel,
          const std::pair< std::vector< std::size_t >,
                           std::vector< std::size_t > >& esup );
 
+//! Generate derived data structure, sparse matrix indices of element node pairs
+std::vector< std::size_t >
+genSpidx( const std::vector< std::size_t >& inpoel,
+          std::size_t nnpe,
+          const std::pair< std::vector< std::size_t >,
+                           std::vector< std::size_t > >& psup );
+
 //! Generate derived data structure, edges surrounding points
 std::pair< std::vector< std::size_t >, std::vector< std::size_t > >
 genEdsup( const std::vector< std::size_t >& inpoel,
@@ -151,6 +158,12 @@ geoFaceTri( const std::array< tk::real, 3 >& x,
 tk::Fields
 genGeoElemTet( const std::vector< std::size_t >& inpoel,
                const tk::UnsMesh::Coords& coord );
+
+//! \brief Generate derived data structure, element geometry with shape
+//!   function derivatives for continuous Galerkin discretizations
+tk::Fields
+genGeoElemTetGrad( const std::vector< std::size_t >& inpoel,
+                   const tk::UnsMesh::Coords& coord );
 } // tk::
 
 #endif // DerivedData_h
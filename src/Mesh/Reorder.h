@@ -36,6 +36,15 @@ std::vector< std::size_t >
 renumber( const std::pair< std::vector< std::size_t >,
                            std::vector< std::size_t > >& psup );
 
+//! Reorder mesh points with the reverse Cuthill-McKee algorithm
+std::vector< std::size_t >
+renumberRCM( const std::pair< std::vector< std::size_t >,
+                              std::vector< std::size_t > >& psup );
+
+//! Reorder mesh elements in ascending order of their lowest node ID
+void
+reorderElems( std::vector< std::size_t >& inpoel, std::size_t nnpe );
+
 //! Assign local ids to global ids
 std::unordered_map< std::size_t, std::size_t >
 assignLid( const std::vector< std::size_t >& gid );
@@ -45,7 +54,8 @@ assignLid( const std::vector< std::size_t >& gid );
 std::tuple< std::vector< std::size_t >,
             std::vector< std::size_t >,
             std::unordered_map< std::size_t, std::size_t > >
-global2local( const std::vector< std::size_t >& ginpoel );
+global2local( const std::vector< std::size_t >& ginpoel,
+              bool reorder = false );
 
 } // ::tk
 
@@ -12,6 +12,7 @@
 
 #include <vector>
 #include <array>
+#include <map>
 #include <memory>
 #include <unordered_set>
 #include <unordered_map>
@@ -221,6 +222,22 @@ class UnsMesh {
     std::vector< std::size_t >& tetinpoel() noexcept { return m_tetinpoel; }
     ///@}
 
+    /** @name Side set node lists accessors */
+    ///@{
+    const std::map< int, std::vector< std::size_t > >& bnode() const noexcept
+    { return m_bnode; }
+    std::map< int, std::vector< std::size_t > >& bnode() noexcept
+    { return m_bnode; }
+    ///@}
+
+    /** @name Side set face lists accessors */
+    ///@{
+    const std::map< int, std::vector< std::size_t > >& bface() const noexcept
+    { return m_bface; }
+    std::map< int, std::vector< std::size_t > >& bface() noexcept
+    { return m_bface; }
+    ///@}
+
   private:
     //! Number of nodes
     //! \details Stores the size (number of nodes) of the mesh graph.
@@ -240,6 +257,11 @@ class UnsMesh {
     std::vector< real > m_y;
     std::vector< real > m_z;
 
+    //! Node lists mapped to side set ids
+    std::map< int, std::vector< std::size_t > > m_bnode;
+    //! Face lists mapped to side set ids
+    std::map< int, std::vector< std::size_t > > m_bface;
+
     //! Compute and return number of unique nodes in element connectivity
     //! \param[in] inpoel Element connectivity
     //! \return Number of unique node ids in connectivity, i.e., the graphsize
@@ -82,27 +82,31 @@ class CGPDE {
     //! Public interface to computing the left-hand side matrix for the diff eq
     void lhs( const std::array< std::vector< tk::real >, 3 >& coord,
               const std::vector< std::size_t >& inpoel,
+              const tk::Fields& geoElem,
               const std::pair< std::vector< std::size_t >,
                                std::vector< std::size_t > >& psup,
+              const std::vector< std::size_t >& spidx,
               tk::Fields& lhsd,
               tk::Fields& lhso ) const
-    { self->lhs( coord, inpoel, psup, lhsd, lhso ); }
+    { self->lhs( coord, inpoel, geoElem, psup, spidx, lhsd, lhso ); }
 
     //! Public interface to computing the right-hand side vector for the diff eq
     void rhs( tk::real t,
               tk::real deltat,
               const std::array< std::vector< tk::real >, 3 >& coord,
               const std::vector< std::size_t >& inpoel,
+              const tk::Fields& geoElem,
               const tk::Fields& U,
               tk::Fields& Ue,
               tk::Fields& R ) const
-    { self->rhs( t, deltat, coord, inpoel, U, Ue, R ); }
+    { self->rhs( t, deltat, coord, inpoel, geoElem, U, Ue, R ); }
 
     //! Public interface for computing the minimum time step size
     tk::real dt( const std::array< std::vector< tk::real >, 3 >& coord,
                  const std::vector< std::size_t >& inpoel,
+                 const tk::Fields& geoElem,
                  const tk::Fields& U ) const
-    { return self->dt( coord, inpoel, U ); }
+    { return self->dt( coord, inpoel, geoElem, U ); }
 
     //! \brief Public interface for collecting all side set IDs the user has
     //!   configured for all components of a PDE system
@@ -155,18 +159,22 @@ class CGPDE {
                                tk::real ) const = 0;
       virtual void lhs( const std::array< std::vector< tk::real >, 3 >&,
                         const std::vector< std::size_t >&,
+                        const tk::Fields&,
                         const std::pair< std::vector< std::size_t >,
                                          std::vector< std::size_t > >&,
+                        const std::vector< std::size_t >&,
                         tk::Fields&, tk::Fields& ) const = 0;
       virtual void rhs( tk::real,
                         tk::real,
                         const std::array< std::vector< tk::real >, 3 >&,
                         const std::vector< std::size_t >&,
                         const tk::Fields&,
+                        const tk::Fields&,
                         tk::Fields&,
                         tk::Fields& ) const = 0;
       virtual tk::real dt( const std::array< std::vector< tk::real >, 3 >&,
                            const std::vector< std::size_t >&,
+                           const tk::Fields&,
                            const tk::Fields& ) const = 0;
       virtual void side( std::unordered_set< int >& conf ) const = 0;
       virtual
@@ -197,22 +205,26 @@ class CGPDE {
       const override { data.initialize( coord, unk, t ); }
       void lhs( const std::array< std::vector< tk::real >, 3 >& coord,
                 const std::vector< std::size_t >& inpoel,
+                const tk::Fields& geoElem,
                 const std::pair< std::vector< std::size_t >,
                                  std::vector< std::size_t > >& psup,
+                const std::vector< std::size_t >& spidx,
                 tk::Fields& lhsd, tk::Fields& lhso ) const override
-      { data.lhs( coord, inpoel, psup, lhsd, lhso ); }
+      { data.lhs( coord, inpoel, geoElem, psup, spidx, lhsd, lhso ); }
       void rhs( tk::real t,
                 tk::real deltat,
                 const std::array< std::vector< tk::real >, 3 >& coord,
                 const std::vector< std::size_t >& inpoel,
+                const tk::Fields& geoElem,
                 const tk::Fields& U,
                 tk::Fields& Ue,
                 tk::Fields& R ) const override
-      { data.rhs( t, deltat, coord, inpoel, U, Ue, R ); }
+      { data.rhs( t, deltat, coord, inpoel, geoElem, U, Ue, R ); }
       tk::real dt( const std::array< std::vector< tk::real >, 3 >& coord,
                    const std::vector< std::size_t >& inpoel,
+                   const tk::Fields& geoElem,
                    const tk::Fields& U ) const override
-      { return data.dt( coord, inpoel, U ); }
+      { return data.dt( coord, inpoel, geoElem, U ); }
       void side( std::unordered_set< int >& conf ) const override
       { data.side( conf ); }
       std::unordered_map< std::size_t, std::vector< std::pair<bool,tk::real> > >
@@ -67,7 +67,9 @@ class CompFlow {
     //! Compute the left hand side sparse matrix
     //! \param[in] coord Mesh node coordinates
     //! \param[in] inpoel Mesh element connectivity
+    //! \param[in] geoElem Element geometry, see tk::genGeoElemTetGrad()
     //! \param[in] psup Linked lists storing IDs of points surrounding points
+    //! \param[in] spidx Sparse matrix (psup1) indices of element node pairs
     //! \param[in,out] lhsd Diagonal of the sparse matrix storing nonzeros
     //! \param[in,out] lhso Off-diagonal of the sparse matrix storing nonzeros
     //! \details Sparse matrix storing the nonzero matrix values at rows and
@@ -77,11 +79,15 @@ class CompFlow {
     //!   at which values are nonzero, are stored by psup (psup1 and psup2,
     //!   where psup2 holds the indices at which psup1 holds the point ids
     //!   surrounding points, see also tk::genPsup()). Note that the number of
-    //!   mesh points (our chunk) npoin = psup.second.size()-1.
+    //!   mesh points (our chunk) npoin = psup.second.size()-1. The positions
+    //!   of the off-diagonal nonzeros of each element are precomputed in spidx
+    //!   (see tk::genSpidx()), so assembly is a direct scatter-add.
     void lhs( const std::array< std::vector< tk::real >, 3 >& coord,
               const std::vector< std::size_t >& inpoel,
+              const tk::Fields& geoElem,
               const std::pair< std::vector< std::size_t >,
                                std::vector< std::size_t > >& psup,
+              const std::vector< std::size_t >& spidx,
               tk::Fields& lhsd,
               tk::Fields& lhso ) const
     {
@@ -91,20 +97,13 @@ class CompFlow {
               "diagonal sparse matrix storage incorrect" );
       Assert( lhso.nunk() == psup.first.size(), "Number of unknowns in "
               "off-diagonal sparse matrix storage incorrect" );
-
-      // Lambda to compute the sparse matrix vector index for row and column
-      // indices. Used only for off-diagonal entries.
-      auto spidx = [ &psup ]( std::size_t r, std::size_t c ) -> std::size_t {
-        Assert( r != c, "Only for computing the off-diagonal indices" );
-        for (auto i=psup.second[r]+1; i<=psup.second[r+1]; ++i)
-          if (c == psup.first[i]) return i;
-        Throw( "Cannot find row, column: " + std::to_string(r) + ',' +
-               std::to_string(c) + " in sparse matrix" );
-      };
-
-      const auto& x = coord[0];
-      const auto& y = coord[1];
-      const auto& z = coord[2];
+      Assert( spidx.size() == inpoel.size()*3, "Size of sparse matrix index "
+              "map incorrect" );
+      Assert( geoElem.nunk() == inpoel.size()/4, "Number of elements in "
+              "element geometry incorrect" );
+      // coord and psup only used in asserts, optimized away in RELEASE mode
+      IGNORE(coord);
+      IGNORE(psup);
 
       // Zero matrix for all components
       for (ncomp_t c=0; c<5; ++c) {
@@ -117,11 +116,9 @@ class CompFlow {
         const auto B = inpoel[e*4+1];
         const auto C = inpoel[e*4+2];
         const auto D = inpoel[e*4+3];
-        std::array< tk::real, 3 > ba{{ x[B]-x[A], y[B]-y[A], z[B]-z[A] }},
-                                  ca{{ x[C]-x[A], y[C]-y[A], z[C]-z[A] }},
-                                  da{{ x[D]-x[A], y[D]-y[A], z[D]-z[A] }};
-        const auto J = tk::triple( ba, ca, da ) / 120.0;
-        Assert( J > 0, "Element Jacobian non-positive" );
+        const auto J = geoElem(e,0,0) / 120.0;
+        // off-diagonal nonzero positions: AB,AC,AD,BA,BC,BD,CA,CB,CD,DA,DB,DC
+        const auto k = &spidx[ e*12 ];
 
         for (ncomp_t c=0; c<5; ++c) {
           const auto r = lhsd.cptr( c, m_offset );
@@ -131,21 +128,7 @@ class CompFlow {
           lhsd.var( r, D ) += 2.0 * J;
 
           const auto s = lhso.cptr( c, m_offset );
-          lhso.var( s, spidx(A,B) ) += J;
-          lhso.var( s, spidx(A,C) ) += J;
-          lhso.var( s, spidx(A,D) ) += J;
-
-          lhso.var( s, spidx(B,A) ) += J;
-          lhso.var( s, spidx(B,C) ) += J;
-          lhso.var( s, spidx(B,D) ) += J;
-
-          lhso.var( s, spidx(C,A) ) += J;
-          lhso.var( s, spidx(C,B) ) += J;
-          lhso.var( s, spidx(C,D) ) += J;
-
-          lhso.var( s, spidx(D,A) ) += J;
-          lhso.var( s, spidx(D,B) ) += J;
-          lhso.var( s, spidx(D,C) ) += J;
+          for (std::size_t i=0; i<12; ++i) lhso.var( s, k[i] ) += J;
         }
       }
     }
@@ -155,12 +138,16 @@ class CompFlow {
     //! \param[in] deltat Size of time step
     //! \param[in] coord Mesh node coordinates
     //! \param[in] inpoel Mesh element connectivity
+    //! \param[in] geoElem Element geometry, see tk::genGeoElemTetGrad()
     //! \param[in] U Solution vector at recent time step
+    //! \param[in,out] Ue Element-centered solution at the half step, only
+    //!   used (and only sized) if the rhs is not fused, see kw::fused_rhs
     //! \param[in,out] R Right-hand side vector computed
     void rhs( tk::real t,
               tk::real deltat,
               const std::array< std::vector< tk::real >, 3 >& coord,
               const std::vector< std::size_t >& inpoel,
+              const tk::Fields& geoElem,
               const tk::Fields& U,
               tk::Fields& Ue,
               tk::Fields& R ) const
@@ -173,6 +160,8 @@ class CompFlow {
       Assert( U.nprop() == 5,
               "Number of components in solution vector must be 5" );
       Assert( R.nprop() == 5, "Number of components in rhs must be 5" );
+      Assert( geoElem.nunk() == inpoel.size()/4, "Number of elements in "
+              "element geometry incorrect" );
 
       const auto& x = coord[0];
       const auto& y = coord[1];
@@ -181,137 +170,48 @@ class CompFlow {
       // ratio of specific heats
       auto g = g_inputdeck.get< tag::param, tag::compflow, tag::gamma >()[0];
 
-      // 1st stage: update element values from node values (gather-add)
-      for (std::size_t e=0; e<inpoel.size()/4; ++e) {
+      // access pointer to right hand side at component and offset
+      std::array< const tk::real*, 5 > r;
+      for (ncomp_t c=0; c<5; ++c) r[c] = R.cptr( c, m_offset );
 
-        // access node IDs
-        const std::array< std::size_t, 4 > N{{ inpoel[e*4+0], inpoel[e*4+1],
-                                               inpoel[e*4+2], inpoel[e*4+3] }};
-        // compute element Jacobi determinant
-        const std::array< tk::real, 3 >
-          ba{{ x[N[1]]-x[N[0]], y[N[1]]-y[N[0]], z[N[1]]-z[N[0]] }},
-          ca{{ x[N[2]]-x[N[0]], y[N[2]]-y[N[0]], z[N[2]]-z[N[0]] }},
-          da{{ x[N[3]]-x[N[0]], y[N[3]]-y[N[0]], z[N[3]]-z[N[0]] }};
-        const auto J = tk::triple( ba, ca, da );        // J = 6V
-        Assert( J > 0, "Element Jacobian non-positive" );
-
-        // shape function derivatives, nnode*ndim [4][3]
-        std::array< std::array< tk::real, 3 >, 4 > grad;
-        grad[1] = tk::crossdiv( ca, da, J );
-        grad[2] = tk::crossdiv( da, ba, J );
-        grad[3] = tk::crossdiv( ba, ca, J );
-        for (std::size_t i=0; i<3; ++i)
-          grad[0][i] = -grad[1][i]-grad[2][i]-grad[3][i];
-
-        // access solution at element nodes
-        std::array< std::array< tk::real, 4 >, 5 > u;
-        for (ncomp_t c=0; c<5; ++c) u[c] = U.extract( c, m_offset, N );
-        // access solution at elements
-        std::array< const tk::real*, 5 > ue;
-        for (ncomp_t c=0; c<5; ++c) ue[c] = Ue.cptr( c, m_offset );
+      // zero right hand side for all components
+      for (ncomp_t c=0; c<5; ++c) R.fill( c, m_offset, 0.0 );
 
-        // pressure
-        std::array< tk::real, 4 > p;
-        for (std::size_t a=0; a<4; ++a)
-          p[a] = (g-1.0)*(u[4][a] - (u[1][a]*u[1][a] +
-                                     u[2][a]*u[2][a] +
-                                     u[3][a]*u[3][a])/2.0/u[0][a]);
+      if (g_inputdeck.get< tag::discr, tag::fusedrhs >()) {
 
-        // sum nodal averages to element
-        for (ncomp_t c=0; c<5; ++c) {
-          Ue.var(ue[c],e) = 0.0;
-          for (std::size_t a=0; a<4; ++a)
-            Ue.var(ue[c],e) += u[c][a]/4.0;
+        // compute both stages in a single pass over the elements, keeping the
+        // element-centered half-step solution in local storage
+        for (std::size_t e=0; e<inpoel.size()/4; ++e) {
+          const std::array< std::size_t, 4 >
+            N{{ inpoel[e*4+0], inpoel[e*4+1], inpoel[e*4+2], inpoel[e*4+3] }};
+          const auto grad = elemGrad( geoElem, e );
+          auto ue = halfstep( t, deltat, g, x, y, z, N, grad, U );
+          scatter( t, deltat, g, e, N, grad, geoElem, ue, r, R );
         }
 
-        // sum flux contributions to element
-        tk::real d = deltat/2.0;
-        for (std::size_t j=0; j<3; ++j)
-          for (std::size_t a=0; a<4; ++a) {
-            // mass: advection
-            Ue.var(ue[0],e) -= d * grad[a][j] * u[j+1][a];
-            // momentum: advection
-            for (std::size_t i=0; i<3; ++i)
-              Ue.var(ue[i+1],e) -= d * grad[a][j] * u[j+1][a]*u[i+1][a]/u[0][a];
-            // momentum: pressure
-            Ue.var(ue[j+1],e) -= d * grad[a][j] * p[a];
-            // energy: advection and pressure
-            Ue.var(ue[4],e) -= d * grad[a][j] *
-                              (u[4][a] + p[a]) * u[j+1][a]/u[0][a];
-          }
-
-        // add (optional) source to all equations
-        std::array< std::array< tk::real, 5 >, 4 > s{{
-          Problem::src( 0, x[N[0]], y[N[0]], z[N[0]], t ),
-          Problem::src( 0, x[N[1]], y[N[1]], z[N[1]], t ),
-          Problem::src( 0, x[N[2]], y[N[2]], z[N[2]], t ),
-          Problem::src( 0, x[N[3]], y[N[3]], z[N[3]], t ) }};
-        for (std::size_t c=0; c<5; ++c)
-          for (std::size_t a=0; a<4; ++a)
-            Ue.var(ue[c],e) += d/4.0 * s[a][c];
-
-      }
+      } else {
 
+        Assert( Ue.nunk() == inpoel.size()/4, "Number of elements in element "
+                "solution vector incorrect" );
 
-      // zero right hand side for all components
-      for (ncomp_t c=0; c<5; ++c) R.fill( c, m_offset, 0.0 );
-
-      // 2nd stage: form rhs from element values (scatter-add)
-      for (std::size_t e=0; e<inpoel.size()/4; ++e) {
+        // 1st stage: update element values from node values (gather-add)
+        for (std::size_t e=0; e<inpoel.size()/4; ++e) {
+          const std::array< std::size_t, 4 >
+            N{{ inpoel[e*4+0], inpoel[e*4+1], inpoel[e*4+2], inpoel[e*4+3] }};
+          const auto grad = elemGrad( geoElem, e );
+          auto ue = halfstep( t, deltat, g, x, y, z, N, grad, U );
+          for (ncomp_t c=0; c<5; ++c) Ue( e, c, m_offset ) = ue[c];
+        }
 
-        // access node IDs
-        const std::array< std::size_t, 4 > N{{ inpoel[e*4+0], inpoel[e*4+1],
-                                               inpoel[e*4+2], inpoel[e*4+3] }};
-        // compute element Jacobi determinant
-        const std::array< tk::real, 3 >
-          ba{{ x[N[1]]-x[N[0]], y[N[1]]-y[N[0]], z[N[1]]-z[N[0]] }},
-          ca{{ x[N[2]]-x[N[0]], y[N[2]]-y[N[0]], z[N[2]]-z[N[0]] }},
-          da{{ x[N[3]]-x[N[0]], y[N[3]]-y[N[0]], z[N[3]]-z[N[0]] }};
-        const auto J = tk::triple( ba, ca, da );        // J = 6V
-        Assert( J > 0, "Element Jacobian non-positive" );
-
-        // shape function derivatives, nnode*ndim [4][3]
-        std::array< std::array< tk::real, 3 >, 4 > grad;
-        grad[1] = tk::crossdiv( ca, da, J );
-        grad[2] = tk::crossdiv( da, ba, J );
-        grad[3] = tk::crossdiv( ba, ca, J );
-        for (std::size_t i=0; i<3; ++i)
-          grad[0][i] = -grad[1][i]-grad[2][i]-grad[3][i];
-
-        // access solution at elements
-        std::array< tk::real, 5 > ue;
-        for (ncomp_t c=0; c<5; ++c) ue[c] = Ue( e, c, m_offset );
-        // access pointer to right hand side at component and offset
-        std::array< const tk::real*, 5 > r;
-        for (ncomp_t c=0; c<5; ++c) r[c] = R.cptr( c, m_offset );
-
-        // pressure
-        auto p = (g-1.0)*(ue[4] -
-                   (ue[1]*ue[1] + ue[2]*ue[2] + ue[3]*ue[3])/2.0/ue[0]);
-
-        // scatter-add flux contributions to rhs at nodes
-        tk::real d = deltat * J/6.0;
-        for (std::size_t j=0; j<3; ++j)
-          for (std::size_t a=0; a<4; ++a) {
-            // mass: advection
-            R.var(r[0],N[a]) += d * grad[a][j] * ue[j+1];
-            // momentum: advection
-            for (std::size_t i=0; i<3; ++i)
-              R.var(r[i+1],N[a]) += d * grad[a][j] * ue[j+1]*ue[i+1]/ue[0];
-            // momentum: pressure
-            R.var(r[j+1],N[a]) += d * grad[a][j] * p;
-            // energy: advection and pressure
-            R.var(r[4],N[a]) += d * grad[a][j] * (ue[4] + p) * ue[j+1]/ue[0];
-          }
-
-        // add (optional) source to all equations
-        auto xc = (x[N[0]] + x[N[1]] + x[N[2]] + x[N[3]]) / 4.0;
-        auto yc = (y[N[0]] + y[N[1]] + y[N[2]] + y[N[3]]) / 4.0;
-        auto zc = (z[N[0]] + z[N[1]] + z[N[2]] + z[N[3]]) / 4.0;
-        auto s = Problem::src( 0, xc, yc, zc, t+deltat/2 );
-        for (std::size_t c=0; c<5; ++c)
-          for (std::size_t a=0; a<4; ++a)
-            R.var(r[c],N[a]) += d/4.0 * s[c];
+        // 2nd stage: form rhs from element values (scatter-add)
+        for (std::size_t e=0; e<inpoel.size()/4; ++e) {
+          const std::array< std::size_t, 4 >
+            N{{ inpoel[e*4+0], inpoel[e*4+1], inpoel[e*4+2], inpoel[e*4+3] }};
+          std::array< tk::real, 5 > ue;
+          for (ncomp_t c=0; c<5; ++c) ue[c] = Ue( e, c, m_offset );
+          const auto grad = elemGrad( geoElem, e );
+          scatter( t, deltat, g, e, N, grad, geoElem, ue, r, R );
+        }
 
       }
 //         // add viscous stress contribution to momentum and energy rhs
@@ -324,16 +224,19 @@ class CompFlow {
     //! \param[in] U Solution vector at recent time step
     //! \param[in] coord Mesh node coordinates
     //! \param[in] inpoel Mesh element connectivity
+    //! \param[in] geoElem Element geometry, see tk::genGeoElemTetGrad()
     //! \return Minimum time step size
     tk::real dt( const std::array< std::vector< tk::real >, 3 >& coord,
                  const std::vector< std::size_t >& inpoel,
+                 const tk::Fields& geoElem,
                  const tk::Fields& U ) const
     {
       Assert( U.nunk() == coord[0].size(), "Number of unknowns in solution "
               "vector at recent time step incorrect" );
-      const auto& x = coord[0];
-      const auto& y = coord[1];
-      const auto& z = coord[2];
+      Assert( geoElem.nunk() == inpoel.size()/4, "Number of elements in "
+              "element geometry incorrect" );
+      // coord only used in asserts, optimized away in RELEASE mode
+      IGNORE(coord);
       // ratio of specific heats
       auto g = g_inputdeck.get< tag::param, tag::compflow, tag::gamma >()[0];
       // compute the minimum dt across all elements we own
@@ -342,11 +245,7 @@ class CompFlow {
         const std::array< std::size_t, 4 > N{{ inpoel[e*4+0], inpoel[e*4+1],
                                                inpoel[e*4+2], inpoel[e*4+3] }};
         // compute cubic root of element volume as the characteristic length
-        const std::array< tk::real, 3 >
-          ba{{ x[N[1]]-x[N[0]], y[N[1]]-y[N[0]], z[N[1]]-z[N[0]] }},
-          ca{{ x[N[2]]-x[N[0]], y[N[2]]-y[N[0]], z[N[2]]-z[N[0]] }},
-          da{{ x[N[3]]-x[N[0]], y[N[3]]-y[N[0]], z[N[3]]-z[N[0]] }};
-        const auto L = std::cbrt( tk::triple( ba, ca, da ) / 6.0 );
+        const auto L = std::cbrt( geoElem(e,0,0) / 6.0 );
         // access solution at element nodes at recent time step
         std::array< std::array< tk::real, 4 >, 5 > u;
         for (ncomp_t c=0; c<5; ++c) u[c] = U.extract( c, m_offset, N );
@@ -473,6 +372,140 @@ class CompFlow {
 
   private:
     const ncomp_t m_offset;             //!< Offset PDE operates from
+
+    //! Extract shape function derivatives of an element
+    //! \param[in] geoElem Element geometry, see tk::genGeoElemTetGrad()
+    //! \param[in] e Element ID
+    //! \return Shape function derivatives, nnode*ndim [4][3]
+    static std::array< std::array< tk::real, 3 >, 4 >
+    elemGrad( const tk::Fields& geoElem, std::size_t e ) {
+      std::array< std::array< tk::real, 3 >, 4 > grad;
+      for (std::size_t a=0; a<4; ++a)
+        for (std::size_t i=0; i<3; ++i)
+          grad[a][i] = geoElem(e,1+a*3+i,0);
+      return grad;
+    }
+
+    //! Compute element-centered half-step solution (1st Lax-Wendroff stage)
+    //! \param[in] t Physical time
+    //! \param[in] deltat Size of time step
+    //! \param[in] g Ratio of specific heats
+    //! \param[in] x Mesh node x coordinates
+    //! \param[in] y Mesh node y coordinates
+    //! \param[in] z Mesh node z coordinates
+    //! \param[in] N Element node IDs
+    //! \param[in] grad Shape function derivatives of the element
+    //! \param[in] U Solution vector at recent time step
+    //! \return Solution at the element centroid at the half step
+    std::array< tk::real, 5 >
+    halfstep( tk::real t,
+              tk::real deltat,
+              tk::real g,
+              const std::vector< tk::real >& x,
+              const std::vector< tk::real >& y,
+              const std::vector< tk::real >& z,
+              const std::array< std::size_t, 4 >& N,
+              const std::array< std::array< tk::real, 3 >, 4 >& grad,
+              const tk::Fields& U ) const
+    {
+      // access solution at element nodes
+      std::array< std::array< tk::real, 4 >, 5 > u;
+      for (ncomp_t c=0; c<5; ++c) u[c] = U.extract( c, m_offset, N );
+
+      // pressure
+      std::array< tk::real, 4 > p;
+      for (std::size_t a=0; a<4; ++a)
+        p[a] = (g-1.0)*(u[4][a] - (u[1][a]*u[1][a] +
+                                   u[2][a]*u[2][a] +
+                                   u[3][a]*u[3][a])/2.0/u[0][a]);
+
+      // sum nodal averages to element
+      std::array< tk::real, 5 > ue;
+      for (ncomp_t c=0; c<5; ++c) {
+        ue[c] = 0.0;
+        for (std::size_t a=0; a<4; ++a)
+          ue[c] += u[c][a]/4.0;
+      }
+
+      // sum flux contributions to element
+      tk::real d = deltat/2.0;
+      for (std::size_t j=0; j<3; ++j)
+        for (std::size_t a=0; a<4; ++a) {
+          // mass: advection
+          ue[0] -= d * grad[a][j] * u[j+1][a];
+          // momentum: advection
+          for (std::size_t i=0; i<3; ++i)
+            ue[i+1] -= d * grad[a][j] * u[j+1][a]*u[i+1][a]/u[0][a];
+          // momentum: pressure
+          ue[j+1] -= d * grad[a][j] * p[a];
+          // energy: advection and pressure
+          ue[4] -= d * grad[a][j] * (u[4][a] + p[a]) * u[j+1][a]/u[0][a];
+        }
+
+      // add (optional) source to all equations
+      std::array< std::array< tk::real, 5 >, 4 > s{{
+        Problem::src( 0, x[N[0]], y[N[0]], z[N[0]], t ),
+        Problem::src( 0, x[N[1]], y[N[1]], z[N[1]], t ),
+        Problem::src( 0, x[N[2]], y[N[2]], z[N[2]], t ),
+        Problem::src( 0, x[N[3]], y[N[3]], z[N[3]], t ) }};
+      for (std::size_t c=0; c<5; ++c)
+        for (std::size_t a=0; a<4; ++a)
+          ue[c] += d/4.0 * s[a][c];
+
+      return ue;
+    }
+
+    //! Scatter-add element contribution to rhs (2nd Lax-Wendroff stage)
+    //! \param[in] t Physical time
+    //! \param[in] deltat Size of time step
+    //! \param[in] g Ratio of specific heats
+    //! \param[in] e Element ID
+    //! \param[in] N Element node IDs
+    //! \param[in] grad Shape function derivatives of the element
+    //! \param[in] geoElem Element geometry, see tk::genGeoElemTetGrad()
+    //! \param[in] ue Solution at the element centroid at the half step
+    //! \param[in] r Pointers to right hand side at components and offset
+    //! \param[in,out] R Right-hand side vector contributed to
+    void scatter( tk::real t,
+                  tk::real deltat,
+                  tk::real g,
+                  std::size_t e,
+                  const std::array< std::size_t, 4 >& N,
+                  const std::array< std::array< tk::real, 3 >, 4 >& grad,
+                  const tk::Fields& geoElem,
+                  const std::array< tk::real, 5 >& ue,
+                  const std::array< const tk::real*, 5 >& r,
+                  tk::Fields& R ) const
+    {
+      // element Jacobi determinant
+      const auto J = geoElem(e,0,0);        // J = 6V
+
+      // pressure
+      auto p = (g-1.0)*(ue[4] -
+                 (ue[1]*ue[1] + ue[2]*ue[2] + ue[3]*ue[3])/2.0/ue[0]);
+
+      // scatter-add flux contributions to rhs at nodes
+      tk::real d = deltat * J/6.0;
+      for (std::size_t j=0; j<3; ++j)
+        for (std::size_t a=0; a<4; ++a) {
+          // mass: advection
+          R.var(r[0],N[a]) += d * grad[a][j] * ue[j+1];
+          // momentum: advection
+          for (std::size_t i=0; i<3; ++i)
+            R.var(r[i+1],N[a]) += d * grad[a][j] * ue[j+1]*ue[i+1]/ue[0];
+          // momentum: pressure
+          R.var(r[j+1],N[a]) += d * grad[a][j] * p;
+          // energy: advection and pressure
+          R.var(r[4],N[a]) += d * grad[a][j] * (ue[4] + p) * ue[j+1]/ue[0];
+        }
+
+      // add (optional) source to all equations
+      auto s = Problem::src( 0, geoElem(e,13,0), geoElem(e,14,0),
+                             geoElem(e,15,0), t+deltat/2 );
+      for (std::size_t c=0; c<5; ++c)
+        for (std::size_t a=0; a<4; ++a)
+          R.var(r[c],N[a]) += d/4.0 * s[c];
+    }
 };
 
 } // cg::
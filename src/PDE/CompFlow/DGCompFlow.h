@@ -166,6 +166,8 @@ class CompFlow {
     //! \param[in] fd Face connectivity data object
     //! \param[in] U Solution vector at recent time step
     //! \param[in,out] R Right-hand side vector computed
+    //! \details Surface integrals on chare-boundary faces are not computed
+    //!   here as they require solution ghost data, see chbIntegral().
     void rhs( tk::real t,
               const tk::Fields& geoFace,
               const tk::Fields& geoElem,
@@ -186,21 +188,12 @@ class CompFlow {
 
       const auto& esuf = fd.Esuf();
 
-      // compute internal surface flux integrals
-      for (auto f=fd.Nbfac(); f<esuf.size()/2; ++f)
-      {
-        std::size_t el = static_cast< std::size_t >(esuf[2*f]);
-        std::size_t er = static_cast< std::size_t >(esuf[2*f+1]);
-        auto farea = geoFace(f,0,0);
-
-        auto flux =
-          m_riemann.flux( f, geoFace, {{U.extract(el), U.extract(er)}} );
-
-        for (ncomp_t c=0; c<5; ++c) {
-          R(el, c, m_offset) -= farea * flux[c];
-          R(er, c, m_offset) += farea * flux[c];
-        }
-      }
+      // compute internal surface flux integrals (excluding chare-boundary
+      // faces, whose ghost data may not yet be available, see chbIntegral())
+      auto nbfac = fd.Nbfac();
+      intSurfInt( fd.Ntfac()-nbfac,
+                  [nbfac]( std::size_t i ){ return nbfac+i; },
+                  esuf, geoFace, U, R );
 
       // compute boundary surface flux integrals
       bndIntegral< Dir >( m_bcdir, fd, geoFace, t, U, R );
@@ -219,16 +212,90 @@ class CompFlow {
       }
     }
 
+    //! Compute surface flux integrals on chare-boundary faces
+    //! \param[in] faces Chare-boundary face IDs adjacent to ghost elements
+    //! \param[in] geoFace Face geometry array
+    //! \param[in] fd Face connectivity data object
+    //! \param[in] U Solution vector at recent time step (including ghosts)
+    //! \param[in,out] R Right-hand side vector to add to
+    //! \details This function adds to the right-hand side computed by rhs()
+    //!   once the solution ghost data on the chare-boundary faces are known.
+    void chbIntegral( const std::vector< std::size_t >& faces,
+                      const tk::Fields& geoFace,
+                      const inciter::FaceData& fd,
+                      const tk::Fields& U,
+                      tk::Fields& R ) const
+    {
+      intSurfInt( faces.size(),
+                  [&faces]( std::size_t i ){ return faces[i]; },
+                  fd.Esuf(), geoFace, U, R );
+    }
+
     //! Compute the minimum time step size
-//     //! \param[in] U Solution vector at recent time step
-//     //! \param[in] coord Mesh node coordinates
-//     //! \param[in] inpoel Mesh element connectivity
+    //! \param[in] coord Mesh node coordinates
+    //! \param[in] inpoel Mesh element connectivity
+    //! \param[in] fd Face connectivity data object
+    //! \param[in] geoFace Face geometry array
+    //! \param[in] geoElem Element geometry array
+    //! \param[in] U Solution vector at recent time step
     //! \return Minimum time step size
-    tk::real dt( const std::array< std::vector< tk::real >, 3 >& /*coord*/,
-                 const std::vector< std::size_t >& /*inpoel*/,
-                 const tk::Fields& /*U*/ ) const
+    //! \details The time step size of an element is its volume divided by the
+    //!   sum, over its faces, of the face area times the largest wave speed,
+    //!   |u.n| + c, normal to the face, evaluated using the element's own
+    //!   state. Using only the element's own state, no ghost element data is
+    //!   required, which is not yet available before the first time step.
+    tk::real dt( const std::array< std::vector< tk::real >, 3 >& coord,
+                 const std::vector< std::size_t >& inpoel,
+                 const inciter::FaceData& fd,
+                 const tk::Fields& geoFace,
+                 const tk::Fields& geoElem,
+                 const tk::Fields& U ) const
     {
+      IGNORE(coord);
+
+      const auto& esuf = fd.Esuf();
+      const auto nelem = inpoel.size()/4;
+
+      // ratio of specific heats
+      auto g = g_inputdeck.get< tag::param, tag::compflow, tag::gamma >()[0];
+
+      // sum of face areas times the largest wave speeds for all elements
+      std::vector< tk::real > delt( nelem, 0.0 );
+
+      for (std::size_t f=0; f<esuf.size()/2; ++f)
+      {
+        auto farea = geoFace(f,0,0);
+        std::array< tk::real, 3 > n{{ geoFace(f,1,0),
+                                      geoFace(f,2,0),
+                                      geoFace(f,3,0) }};
+
+        // contribute to the elements on both sides that we own
+        for (std::size_t s=0; s<2; ++s) {
+          if (esuf[2*f+s] < 0) continue;
+          auto e = static_cast< std::size_t >( esuf[2*f+s] );
+          if (e >= nelem) continue;     // skip ghost elements
+
+          auto r = U(e,0,m_offset);
+          auto u = U(e,1,m_offset)/r;
+          auto v = U(e,2,m_offset)/r;
+          auto w = U(e,3,m_offset)/r;
+          auto p = (g-1.0)*(U(e,4,m_offset) - r*(u*u + v*v + w*w)/2.0);
+          if (p < 0) p = 0.0;
+          auto c = std::sqrt( g*p/r );
+
+          delt[e] += farea * (std::fabs( u*n[0] + v*n[1] + w*n[2] ) + c);
+        }
+      }
+
       tk::real mindt = std::numeric_limits< tk::real >::max();
+
+      // compute allowable dt for all elements and find the minimum
+      for (std::size_t e=0; e<nelem; ++e)
+        if (delt[e] > 0.0) {
+          auto edt = geoElem(e,0,0) / delt[e];
+          if (edt < mindt) mindt = edt;
+        }
+
       return mindt;
     }
 
@@ -305,33 +372,41 @@ class CompFlow {
     //! Extrapolation BC configuration
     const std::vector< bcconf_t > m_bcextrapolate;
 
+    //! Extract the state of the conserved variables in an element
+    //! \param[in] U Solution vector at recent time step
+    //! \param[in] e Element ID
+    //! \return Fixed-size array of the five conserved variables in element e
+    std::array< tk::real, 5 > state( const tk::Fields& U, std::size_t e ) const
+    {
+      return {{ U(e,0,m_offset), U(e,1,m_offset), U(e,2,m_offset),
+                U(e,3,m_offset), U(e,4,m_offset) }};
+    }
+
     //! \brief State policy class providing the left and right state of a face
     //!   at Dirichlet boundaries
     struct Dir {
-      static std::array< std::vector< tk::real >, 2 >
-      LR( const tk::Fields& U, std::size_t e,
+      static std::array< std::array< tk::real, 5 >, 2 >
+      LR( const std::array< tk::real, 5 >& ul,
           tk::real xc, tk::real yc, tk::real zc,
           std::array< tk::real, 3 > /*fn*/,
           tk::real t ) {
-        auto ul = U.extract( e );
-        auto ur = ul;
+        std::array< tk::real, 5 > ur;
         const auto urbc = Problem::solution(0, xc, yc, zc, t);
         for (ncomp_t c=0; c<5; ++c)
           ur[c] = urbc[c];
-        return {{ std::move(ul), std::move(ur) }};
+        return {{ ul, ur }};
       }
     };
 
     //! \brief State policy class providing the left and right state of a face
     //!   at symmetric boundaries
     struct Sym {
-      static std::array< std::vector< tk::real >, 2 >
-      LR( const tk::Fields& U, std::size_t e,
+      static std::array< std::array< tk::real, 5 >, 2 >
+      LR( const std::array< tk::real, 5 >& ul,
           tk::real /*xc*/, tk::real /*yc*/, tk::real /*zc*/,
           std::array< tk::real, 3 > fn,
           tk::real /*t*/ ) {
-        auto ul = U.extract( e );
-        auto ur = ul;
+        std::array< tk::real, 5 > ur;
         // Internal cell velocity components
         auto v1l = ul[1]/ul[0];
         auto v2l = ul[2]/ul[0];
@@ -348,22 +423,70 @@ class CompFlow {
         ur[2] = ur[0] * v2r;
         ur[3] = ur[0] * v3r;
         ur[4] = ul[4];
-        return {{ std::move(ul), std::move(ur) }};
+        return {{ ul, ur }};
       }
     };
 
     //! \brief State policy class providing the left and right state of a face
     //!   at extrapolation boundaries
     struct Extrapolate {
-      static std::array< std::vector< tk::real >, 2 >
-      LR( const tk::Fields& U, std::size_t e,
+      static std::array< std::array< tk::real, 5 >, 2 >
+      LR( const std::array< tk::real, 5 >& ul,
           tk::real /*xc*/, tk::real /*yc*/, tk::real /*zc*/,
           std::array< tk::real, 3 > /*fn*/,
           tk::real /*t*/ ) {
-        return {{ U.extract( e ), U.extract( e ) }};
+        return {{ ul, ul }};
       }
     };
 
+    //! Compute internal surface flux integrals for a number of faces
+    //! \param[in] nf Number of faces at which to compute surface integral
+    //! \param[in] fid Functor returning the face ID for a face index < nf
+    //! \param[in] esuf Elements surrounding face, see tk::genEsuf()
+    //! \param[in] geoFace Face geometry array
+    //! \param[in] U Solution vector at recent time step
+    //! \param[in,out] R Right-hand side vector computed
+    //! \details The faces are processed in blocks of FaceBlock::N.
+    template< class FaceId >
+    void intSurfInt( std::size_t nf,
+                     FaceId fid,
+                     const std::vector< int >& esuf,
+                     const tk::Fields& geoFace,
+                     const tk::Fields& U,
+                     tk::Fields& R ) const
+    {
+      FaceBlock b;
+      for (std::size_t k=0; k<nf; k+=FaceBlock::N) {
+        b.size = std::min( FaceBlock::N, nf-k );
+
+        // gather face normals and left and right states
+        for (std::size_t i=0; i<b.size; ++i) {
+          auto f = fid( k+i );
+          std::size_t el = static_cast< std::size_t >(esuf[2*f]);
+          std::size_t er = static_cast< std::size_t >(esuf[2*f+1]);
+          for (std::size_t j=0; j<3; ++j) b.fn[j][i] = geoFace(f,j+1,0);
+          for (ncomp_t c=0; c<5; ++c) {
+            b.u[0][c][i] = U(el, c, m_offset);
+            b.u[1][c][i] = U(er, c, m_offset);
+          }
+        }
+
+        m_riemann.flux( b );
+
+        // scatter fluxes to elements
+        for (std::size_t i=0; i<b.size; ++i) {
+          auto f = fid( k+i );
+          std::size_t el = static_cast< std::size_t >(esuf[2*f]);
+          std::size_t er = static_cast< std::size_t >(esuf[2*f+1]);
+          auto farea = geoFace(f,0,0);
+          for (ncomp_t c=0; c<5; ++c) {
+            R(el, c, m_offset) -= farea * b.flx[c][i];
+            R(er, c, m_offset) += farea * b.flx[c][i];
+          }
+        }
+      }
+    }
+
     //! Compute boundary surface integral for a number of faces
     //! \param[in] faces Face IDs at which to compute surface integral
     //! \param[in] esuf Elements surrounding face, see tk::genEsuf()
@@ -381,22 +504,39 @@ class CompFlow {
                   const tk::Fields& U,
                   tk::Fields& R ) const
     {
-      for (const auto& f : faces) {
-        std::size_t el = static_cast< std::size_t >(esuf[2*f]);
-        Assert( esuf[2*f+1] == -1, "outside boundary element not -1" );
-        auto farea = geoFace(f,0,0);
-        auto xc = geoFace(f,4,0);
-        auto yc = geoFace(f,5,0);
-        auto zc = geoFace(f,6,0);
-        std::array< tk::real, 3 > fn {{ geoFace(f,1,0),
-                                        geoFace(f,2,0),
-                                        geoFace(f,3,0) }};
+      FaceBlock b;
+      for (std::size_t k=0; k<faces.size(); k+=FaceBlock::N) {
+        b.size = std::min( FaceBlock::N, faces.size()-k );
+
+        // gather face normals and left and right states from boundary policy
+        for (std::size_t i=0; i<b.size; ++i) {
+          auto f = faces[k+i];
+          std::size_t el = static_cast< std::size_t >(esuf[2*f]);
+          Assert( esuf[2*f+1] == -1, "outside boundary element not -1" );
+          auto xc = geoFace(f,4,0);
+          auto yc = geoFace(f,5,0);
+          auto zc = geoFace(f,6,0);
+          std::array< tk::real, 3 > fn {{ geoFace(f,1,0),
+                                          geoFace(f,2,0),
+                                          geoFace(f,3,0) }};
+          auto ulr = State::LR( state(U,el), xc, yc, zc, fn, t );
+          for (std::size_t j=0; j<3; ++j) b.fn[j][i] = fn[j];
+          for (ncomp_t c=0; c<5; ++c) {
+            b.u[0][c][i] = ulr[0][c];
+            b.u[1][c][i] = ulr[1][c];
+          }
+        }
 
         //--- fluxes
-        auto flux = m_riemann.flux( f, geoFace, State::LR(U,el,xc,yc,zc,fn,t) );
-
-        for (ncomp_t c=0; c<5; ++c)
-          R(el, c, m_offset) -= farea * flux[c];
+        m_riemann.flux( b );
+
+        for (std::size_t i=0; i<b.size; ++i) {
+          auto f = faces[k+i];
+          std::size_t el = static_cast< std::size_t >(esuf[2*f]);
+          auto farea = geoFace(f,0,0);
+          for (ncomp_t c=0; c<5; ++c)
+            R(el, c, m_offset) -= farea * b.flx[c][i];
+        }
       }
     }
 
@@ -10,10 +10,12 @@
 #ifndef HLLC_h
 #define HLLC_h
 
-#include <vector>
+#include <array>
+#include <cmath>
 
 #include "Types.h"
-#include "Fields.h"
+#include "SIMD.h"
+#include "CompFlow/RiemannSolver.h"
 #include "Inciter/Options/Flux.h"
 
 namespace inciter {
@@ -21,113 +23,119 @@ namespace inciter {
 //! HLLC approximate Riemann solver
 //! \details This class is used polymorphically with inciter::RiemannSolver
 struct HLLC {
-  //! HLLC approximate Riemann solver flux function
-  //! \param[in] f Face ID
-  //! \param[in] geoFace Face geometry array
-  //! \param[in] u Left and right unknown/state vector
-  //! \return Riemann solution using a central difference method
-  std::vector< tk::real >
-  flux( std::size_t f,
-        const tk::Fields& geoFace,
-        const std::array< std::vector< tk::real >, 2 >& u ) const
+  //! HLLC approximate Riemann solver flux function for a block of faces
+  //! \param[in,out] b Block of faces with unit normals and left and right
+  //!   states on input and the Riemann fluxes on output
+  void flux( FaceBlock& b ) const
+  { flux( g_inputdeck.get< tag::param, tag::compflow, tag::gamma >()[0], b ); }
+
+  //! HLLC approximate Riemann solver flux kernel for a block of faces
+  //! \param[in] g Ratio of specific heats
+  //! \param[in,out] b Block of faces with unit normals and left and right
+  //!   states on input and the Riemann fluxes on output
+  //! \details The faces are processed a SIMD pack at a time, the remainder
+  //!   one at a time.
+  static void flux( tk::real g, FaceBlock& b )
   {
-    std::vector< tk::real > flx( u[0].size(), 0 );
+    using tk::simd::pack;
+    const auto w = tk::simd::width< pack >::value;
+    std::size_t i = 0;
+    for (; i+w <= b.size; i += w) flux< pack >( g, b, i );
+    for (; i < b.size; ++i) flux< tk::real >( g, b, i );
+  }
+
+  //! HLLC approximate Riemann solver flux kernel for consecutive faces
+  //! \tparam V Value type: tk::simd::pack or tk::real
+  //! \param[in] g Ratio of specific heats
+  //! \param[in,out] b Block of faces with unit normals and left and right
+  //!   states on input and the Riemann fluxes on output
+  //! \param[in] i Index of the first of tk::simd::width< V >::value faces in
+  //!   the block to compute the fluxes of
+  //! \details All four candidate fluxes (left, left-star, right-star, right)
+  //!   are computed for every face and the one corresponding to the wave
+  //!   pattern is selected without branching so that the pack instantiation
+  //!   computes the same fluxes as the scalar one for every lane.
+  template< class V >
+  static void flux( tk::real g, FaceBlock& b, std::size_t i )
+  {
+    using tk::simd::load;
+    using tk::simd::select;
 
-    std::array< tk::real, 3 > fn {{ geoFace(f,1,0),
-                                    geoFace(f,2,0),
-                                    geoFace(f,3,0) }};
+    std::array< V, 5 > ul, ur;
+    for (std::size_t c=0; c<5; ++c) {
+      ul[c] = load< V >( &b.u[0][c][i] );
+      ur[c] = load< V >( &b.u[1][c][i] );
+    }
 
-    // ratio of specific heats
-    auto g = g_inputdeck.get< tag::param, tag::compflow, tag::gamma >()[0];
+    std::array< V, 3 > fn {{ load< V >( &b.fn[0][i] ),
+                             load< V >( &b.fn[1][i] ),
+                             load< V >( &b.fn[2][i] ) }};
 
     // Primitive variables
-    auto rhol = u[0][0];
-    auto rhor = u[1][0];
+    auto rhol = ul[0];
+    auto rhor = ur[0];
 
-    auto pl = (g-1.0)*(u[0][4] - (u[0][1]*u[0][1] +
-                                  u[0][2]*u[0][2] +
-                                  u[0][3]*u[0][3]) / (2.0*rhol));
+    auto pl = (g-1.0)*(ul[4] - (ul[1]*ul[1] +
+                                ul[2]*ul[2] +
+                                ul[3]*ul[3]) / (2.0*rhol));
 
-    auto pr = (g-1.0)*(u[1][4] - (u[1][1]*u[1][1] +
-                                  u[1][2]*u[1][2] +
-                                  u[1][3]*u[1][3]) / (2.0*rhor));
+    auto pr = (g-1.0)*(ur[4] - (ur[1]*ur[1] +
+                                ur[2]*ur[2] +
+                                ur[3]*ur[3]) / (2.0*rhor));
 
-    auto al = sqrt(g * pl / rhol);
-    auto ar = sqrt(g * pr / rhor);
+    auto al = tk::simd::sqrt(g * pl / rhol);
+    auto ar = tk::simd::sqrt(g * pr / rhor);
 
     // Face-normal velocities
-    auto ul = u[0][1]/rhol;
-    auto vl = u[0][2]/rhol;
-    auto wl = u[0][3]/rhol;
-
-    tk::real vnl = ul*fn[0] + vl*fn[1] + wl*fn[2];
-
-    auto ur = u[1][1]/rhor;
-    auto vr = u[1][2]/rhor;
-    auto wr = u[1][3]/rhor;
-
-    tk::real vnr = ur*fn[0] + vr*fn[1] + wr*fn[2];
+    V vnl = ul[1]/rhol*fn[0] + ul[2]/rhol*fn[1] + ul[3]/rhol*fn[2];
+    V vnr = ur[1]/rhor*fn[0] + ur[2]/rhor*fn[1] + ur[3]/rhor*fn[2];
 
     // Roe-averaged variables
-    auto rlr = sqrt(rhor/rhol);
+    auto rlr = tk::simd::sqrt(rhor/rhol);
     auto rlr1 = 1.0 + rlr;
 
     auto vnroe = (vnr*rlr + vnl)/rlr1 ;
     auto aroe = (ar*rlr + al)/rlr1 ;
 
     // Signal velocities
-    auto Sl = fmin(vnl-al, vnroe-aroe);
-    auto Sr = fmax(vnr+ar, vnroe+aroe);
+    auto Sl = tk::simd::min(vnl-al, vnroe-aroe);
+    auto Sr = tk::simd::max(vnr+ar, vnroe+aroe);
     auto Sm = ( rhor*vnr*(Sr-vnr) - rhol*vnl*(Sl-vnl) + pl-pr )
              /( rhor*(Sr-vnr) - rhol*(Sl-vnl) );
 
     // Middle-zone (star) variables
     auto pStar = rhol*(vnl-Sl)*(vnl-Sm) + pl;
-    auto uStar = u;
-
-    uStar[0][0] = (Sl-vnl) * rhol/ (Sl-Sm);
-    uStar[0][1] = ((Sl-vnl) * u[0][1] + (pStar-pl)*fn[0]) / (Sl-Sm);
-    uStar[0][2] = ((Sl-vnl) * u[0][2] + (pStar-pl)*fn[1]) / (Sl-Sm);
-    uStar[0][3] = ((Sl-vnl) * u[0][3] + (pStar-pl)*fn[2]) / (Sl-Sm);
-    uStar[0][4] = ((Sl-vnl) * u[0][4] - pl*vnl + pStar*Sm) / (Sl-Sm);
-
-    uStar[1][0] = (Sr-vnr) * rhor/ (Sr-Sm);
-    uStar[1][1] = ((Sr-vnr) * u[1][1] + (pStar-pr)*fn[0]) / (Sr-Sm);
-    uStar[1][2] = ((Sr-vnr) * u[1][2] + (pStar-pr)*fn[1]) / (Sr-Sm);
-    uStar[1][3] = ((Sr-vnr) * u[1][3] + (pStar-pr)*fn[2]) / (Sr-Sm);
-    uStar[1][4] = ((Sr-vnr) * u[1][4] - pr*vnr + pStar*Sm) / (Sr-Sm);
-
-    // Numerical fluxes
-    if (Sl > 0.0) {
-      flx[0] = u[0][0] * vnl;
-      flx[1] = u[0][1] * vnl + pl*fn[0];
-      flx[2] = u[0][2] * vnl + pl*fn[1];
-      flx[3] = u[0][3] * vnl + pl*fn[2];
-      flx[4] = ( u[0][4] + pl ) * vnl;
-    }
-    else if (Sl <= 0.0 && Sm > 0.0) {
-      flx[0] = uStar[0][0] * Sm;
-      flx[1] = uStar[0][1] * Sm + pStar*fn[0];
-      flx[2] = uStar[0][2] * Sm + pStar*fn[1];
-      flx[3] = uStar[0][3] * Sm + pStar*fn[2];
-      flx[4] = ( uStar[0][4] + pStar ) * Sm;
-    }
-    else if (Sm <= 0.0 && Sr >= 0.0) {
-      flx[0] = uStar[1][0] * Sm;
-      flx[1] = uStar[1][1] * Sm + pStar*fn[0];
-      flx[2] = uStar[1][2] * Sm + pStar*fn[1];
-      flx[3] = uStar[1][3] * Sm + pStar*fn[2];
-      flx[4] = ( uStar[1][4] + pStar ) * Sm;
-    }
-    else {
-      flx[0] = u[1][0] * vnr;
-      flx[1] = u[1][1] * vnr + pr*fn[0];
-      flx[2] = u[1][2] * vnr + pr*fn[1];
-      flx[3] = u[1][3] * vnr + pr*fn[2];
-      flx[4] = ( u[1][4] + pr ) * vnr;
-    }
 
-    return flx;
+    std::array< V, 5 > usl, usr;
+    usl[0] = (Sl-vnl) * rhol/ (Sl-Sm);
+    usr[0] = (Sr-vnr) * rhor/ (Sr-Sm);
+    for (std::size_t j=0; j<3; ++j) {
+      usl[j+1] = ((Sl-vnl) * ul[j+1] + (pStar-pl)*fn[j]) / (Sl-Sm);
+      usr[j+1] = ((Sr-vnr) * ur[j+1] + (pStar-pr)*fn[j]) / (Sr-Sm);
+    }
+    usl[4] = ((Sl-vnl) * ul[4] - pl*vnl + pStar*Sm) / (Sl-Sm);
+    usr[4] = ((Sr-vnr) * ur[4] - pr*vnr + pStar*Sm) / (Sr-Sm);
+
+    // Numerical fluxes: select the one corresponding to the wave pattern
+    auto left = Sl > 0.0;
+    auto lstar = Sm > 0.0;
+    auto rstar = Sr >= 0.0;
+    tk::simd::store( &b.flx[0][i],
+      select( left, ul[0] * vnl,
+      select( lstar, usl[0] * Sm,
+      select( rstar, usr[0] * Sm,
+                     ur[0] * vnr ) ) ) );
+    for (std::size_t j=0; j<3; ++j)
+      tk::simd::store( &b.flx[j+1][i],
+        select( left, ul[j+1] * vnl + pl*fn[j],
+        select( lstar, usl[j+1] * Sm + pStar*fn[j],
+        select( rstar, usr[j+1] * Sm + pStar*fn[j],
+                       ur[j+1] * vnr + pr*fn[j] ) ) ) );
+    tk::simd::store( &b.flx[4][i],
+      select( left, ( ul[4] + pl ) * vnl,
+      select( lstar, ( usl[4] + pStar ) * Sm,
+      select( rstar, ( usr[4] + pStar ) * Sm,
+                     ( ur[4] + pr ) * vnr ) ) ) );
   }
 
   //! Flux type accessor
@@ -9,10 +9,12 @@
 #ifndef LaxFriedrichs_h
 #define LaxFriedrichs_h
 
-#include <vector>
+#include <array>
+#include <cmath>
 
 #include "Types.h"
-#include "Fields.h"
+#include "SIMD.h"
+#include "CompFlow/RiemannSolver.h"
 #include "Inciter/Options/Flux.h"
 
 namespace inciter {
@@ -20,78 +22,89 @@ namespace inciter {
 //! Lax-Friedrichs approximate Riemann solver
 //! \details This class is used polymorphically with inciter::RiemannSolver
 struct LaxFriedrichs {
-  //! Lax-Friedrichs approximate Riemann solver flux function
-  //! \param[in] f Face ID
-  //! \param[in] geoFace Face geometry array
-  //! \param[in] u Left and right unknown/state vector
-  //! \return Riemann solution using central difference method
-  std::vector< tk::real >
-  flux( std::size_t f,
-        const tk::Fields& geoFace,
-        const std::array< std::vector< tk::real >, 2 >& u ) const
+  //! Lax-Friedrichs approximate Riemann solver flux function for a block of
+  //!   faces
+  //! \param[in,out] b Block of faces with unit normals and left and right
+  //!   states on input and the Riemann fluxes on output
+  void flux( FaceBlock& b ) const
+  { flux( g_inputdeck.get< tag::param, tag::compflow, tag::gamma >()[0], b ); }
+
+  //! Lax-Friedrichs approximate Riemann solver flux kernel for a block of
+  //!   faces
+  //! \param[in] g Ratio of specific heats
+  //! \param[in,out] b Block of faces with unit normals and left and right
+  //!   states on input and the Riemann fluxes on output
+  //! \details The faces are processed a SIMD pack at a time, the remainder
+  //!   one at a time.
+  static void flux( tk::real g, FaceBlock& b )
   {
-    std::vector< tk::real >  flx( u[0].size(), 0.0 ),
-                            fluxl( u[0].size(), 0.0 ),
-                            fluxr( u[0].size(), 0.0 );
+    using tk::simd::pack;
+    const auto w = tk::simd::width< pack >::value;
+    std::size_t i = 0;
+    for (; i+w <= b.size; i += w) flux< pack >( g, b, i );
+    for (; i < b.size; ++i) flux< tk::real >( g, b, i );
+  }
+
+  //! Lax-Friedrichs approximate Riemann solver flux kernel for consecutive
+  //!   faces
+  //! \tparam V Value type: tk::simd::pack or tk::real
+  //! \param[in] g Ratio of specific heats
+  //! \param[in,out] b Block of faces with unit normals and left and right
+  //!   states on input and the Riemann fluxes on output
+  //! \param[in] i Index of the first of tk::simd::width< V >::value faces in
+  //!   the block to compute the fluxes of
+  template< class V >
+  static void flux( tk::real g, FaceBlock& b, std::size_t i )
+  {
+    using tk::simd::load;
 
-    std::array< tk::real, 3 > fn {{ geoFace(f,1,0),
-                                    geoFace(f,2,0),
-                                    geoFace(f,3,0) }};
+    std::array< V, 5 > ul, ur;
+    for (std::size_t c=0; c<5; ++c) {
+      ul[c] = load< V >( &b.u[0][c][i] );
+      ur[c] = load< V >( &b.u[1][c][i] );
+    }
 
-    // ratio of specific heats
-    auto g = g_inputdeck.get< tag::param, tag::compflow, tag::gamma >()[0];
+    std::array< V, 3 > fn {{ load< V >( &b.fn[0][i] ),
+                             load< V >( &b.fn[1][i] ),
+                             load< V >( &b.fn[2][i] ) }};
 
     // Primitive variables
-    auto rhol = u[0][0];
-    auto rhor = u[1][0];
+    auto rhol = ul[0];
+    auto rhor = ur[0];
 
-    auto pl = (g-1.0)*(u[0][4] - (u[0][1]*u[0][1] +
-                                  u[0][2]*u[0][2] +
-                                  u[0][3]*u[0][3]) / (2.0*rhol));
+    auto pl = (g-1.0)*(ul[4] - (ul[1]*ul[1] +
+                                ul[2]*ul[2] +
+                                ul[3]*ul[3]) / (2.0*rhol));
 
-    auto pr = (g-1.0)*(u[1][4] - (u[1][1]*u[1][1] +
-                                  u[1][2]*u[1][2] +
-                                  u[1][3]*u[1][3]) / (2.0*rhor));
+    auto pr = (g-1.0)*(ur[4] - (ur[1]*ur[1] +
+                                ur[2]*ur[2] +
+                                ur[3]*ur[3]) / (2.0*rhor));
 
-    auto al = sqrt(g * pl / rhol);
-    auto ar = sqrt(g * pr / rhor);
+    auto al = tk::simd::sqrt(g * pl / rhol);
+    auto ar = tk::simd::sqrt(g * pr / rhor);
 
     // Face-normal velocities
-    auto ul = u[0][1]/rhol;
-    auto vl = u[0][2]/rhol;
-    auto wl = u[0][3]/rhol;
-
-    tk::real vnl = ul*fn[0] + vl*fn[1] + wl*fn[2];
-
-    auto ur = u[1][1]/rhor;
-    auto vr = u[1][2]/rhor;
-    auto wr = u[1][3]/rhor;
-
-    tk::real vnr = ur*fn[0] + vr*fn[1] + wr*fn[2];
+    V vnl = ul[1]/rhol*fn[0] + ul[2]/rhol*fn[1] + ul[3]/rhol*fn[2];
+    V vnr = ur[1]/rhor*fn[0] + ur[2]/rhor*fn[1] + ur[3]/rhor*fn[2];
 
     // Flux functions
-    fluxl[0] = u[0][0] * vnl;
-    fluxl[1] = u[0][1] * vnl + pl*fn[0];
-    fluxl[2] = u[0][2] * vnl + pl*fn[1];
-    fluxl[3] = u[0][3] * vnl + pl*fn[2];
-    fluxl[4] = ( u[0][4] + pl ) * vnl;
-
-    fluxr[0] = u[1][0] * vnr;
-    fluxr[1] = u[1][1] * vnr + pr*fn[0];
-    fluxr[2] = u[1][2] * vnr + pr*fn[1];
-    fluxr[3] = u[1][3] * vnr + pr*fn[2];
-    fluxr[4] = ( u[1][4] + pr ) * vnr;
+    std::array< V, 5 > fluxl, fluxr;
+    fluxl[0] = ul[0] * vnl;
+    fluxr[0] = ur[0] * vnr;
+    for (std::size_t j=0; j<3; ++j) {
+      fluxl[j+1] = ul[j+1] * vnl + pl*fn[j];
+      fluxr[j+1] = ur[j+1] * vnr + pr*fn[j];
+    }
+    fluxl[4] = ( ul[4] + pl ) * vnl;
+    fluxr[4] = ( ur[4] + pr ) * vnr;
 
-    auto lambda = fmax(al,ar) + fmax(fabs(vnl),fabs(vnr));
+    auto lambda = tk::simd::max(al,ar) +
+                  tk::simd::max(tk::simd::abs(vnl),tk::simd::abs(vnr));
 
     // Numerical flux function
-    for(ncomp_t c=0; c<5; ++c)
-    {
-      flx[c] = 0.5 * ( fluxl[c] + fluxr[c]
-                       - lambda * (u[1][c] - u[0][c]) );
-    }
-
-    return flx;
+    for (std::size_t c=0; c<5; ++c)
+      tk::simd::store( &b.flx[c][i],
+        0.5 * ( fluxl[c] + fluxr[c] - lambda * (ur[c] - ul[c]) ) );
   }
 
   //! Flux type accessor
@@ -16,14 +16,33 @@
 #define RiemannSolver_h
 
 #include <array>
-#include <vector>
+#include <cstddef>
+#include <functional>
 
 #include "Types.h"
 #include "Make_unique.h"
-#include "Fields.h"
 
 namespace inciter {
 
+//! \brief Block of faces whose data is stored as structure of arrays for the
+//!   batched Riemann solvers
+//! \details The face normals and the left and right states of a number of
+//!   faces are gathered into contiguous arrays, indexed by the face within the
+//!   block last, so that the Riemann solvers can compute the fluxes of all
+//!   faces of the block in a single loop, amenable to vectorization.
+struct FaceBlock {
+  //! Maximum number of faces in a block
+  static constexpr std::size_t N = 32;
+  //! Number of faces stored in the block
+  std::size_t size = 0;
+  //! Unit normals of faces, [direction][face]
+  std::array< std::array< tk::real, N >, 3 > fn;
+  //! Left and right states of faces, [side][component][face]
+  std::array< std::array< std::array< tk::real, N >, 5 >, 2 > u;
+  //! Fluxes computed at faces, [component][face]
+  std::array< std::array< tk::real, N >, 5 > flx;
+};
+
 //! \brief Generic Riemann solver interface class for various Riemann solvers
 //! \details This class uses runtime polymorphism without client-side
 //!   inheritance: inheritance is confined to the internals of this class,
@@ -66,12 +85,8 @@ class RiemannSolver {
       self( tk::make_unique< Model<T> >(
               std::move( x( std::forward<Args>(args)... ) ) ) ) {}
 
-    //! Public interface to computing the Riemann flux
-    std::vector< tk::real >
-    flux( std::size_t f,
-          const tk::Fields& geoFace,
-          const std::array< std::vector< tk::real >, 2 >& u ) const
-    { return self->flux( f, geoFace, u ); }
+    //! Public interface to computing the Riemann fluxes of a block of faces
+    void flux( FaceBlock& b ) const { self->flux( b ); }
 
     //! Copy assignment
     RiemannSolver& operator=( const RiemannSolver& x )
@@ -92,10 +107,7 @@ class RiemannSolver {
       Concept( const Concept& ) = default;
       virtual ~Concept() = default;
       virtual Concept* copy() const = 0;
-      virtual std::vector< tk::real >
-        flux( std::size_t,
-              const tk::Fields&,
-              const std::array< std::vector< tk::real >, 2 >& ) const = 0;
+      virtual void flux( FaceBlock& ) const = 0;
     };
 
     //! \brief Model models the Concept above by deriving from it and overriding
@@ -104,11 +116,7 @@ class RiemannSolver {
     struct Model : Concept {
       Model( T x ) : data( std::move(x) ) {}
       Concept* copy() const override { return new Model( *this ); }
-      std::vector< tk::real >
-        flux( std::size_t f,
-              const tk::Fields& geoFace,
-              const std::array< std::vector< tk::real >, 2 >& u ) const override
-      { return data.flux( f, geoFace, u ); }
+      void flux( FaceBlock& b ) const override { data.flux( b ); }
       T data;
     };
 
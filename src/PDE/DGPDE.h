@@ -92,11 +92,23 @@ class DGPDE {
               tk::Fields& R ) const
     { self->rhs( t, geoFace, geoElem, fd, U, R ); }
 
+    //! \brief Public interface to computing the right-hand side contributions
+    //!   on chare-boundary faces for the diff eq
+    void chbIntegral( const std::vector< std::size_t >& faces,
+                      const tk::Fields& geoFace,
+                      const inciter::FaceData& fd,
+                      const tk::Fields& U,
+                      tk::Fields& R ) const
+    { self->chbIntegral( faces, geoFace, fd, U, R ); }
+
     //! Public interface for computing the minimum time step size
     tk::real dt( const std::array< std::vector< tk::real >, 3 >& coord,
                  const std::vector< std::size_t >& inpoel,
+                 const inciter::FaceData& fd,
+                 const tk::Fields& geoFace,
+                 const tk::Fields& geoElem,
                  const tk::Fields& U ) const
-    { return self->dt( coord, inpoel, U ); }
+    { return self->dt( coord, inpoel, fd, geoFace, geoElem, U ); }
 
     //! \brief Public interface for collecting all side set IDs the user has
     //!   configured for all components of a PDE system
@@ -144,8 +156,16 @@ class DGPDE {
                         const inciter::FaceData&,
                         const tk::Fields&,
                         tk::Fields& ) const = 0;
+      virtual void chbIntegral( const std::vector< std::size_t >&,
+                                const tk::Fields&,
+                                const inciter::FaceData&,
+                                const tk::Fields&,
+                                tk::Fields& ) const = 0;
       virtual tk::real dt( const std::array< std::vector< tk::real >, 3 >&,
                            const std::vector< std::size_t >&,
+                           const inciter::FaceData&,
+                           const tk::Fields&,
+                           const tk::Fields&,
                            const tk::Fields& ) const = 0;
       virtual void side( std::unordered_set< int >& conf ) const = 0;
       virtual std::vector< std::string > fieldNames() const = 0;
@@ -176,10 +196,19 @@ class DGPDE {
                 const tk::Fields& U,
                 tk::Fields& R ) const override
       { data.rhs( t, geoFace, geoElem, fd, U, R ); }
+      void chbIntegral( const std::vector< std::size_t >& faces,
+                        const tk::Fields& geoFace,
+                        const inciter::FaceData& fd,
+                        const tk::Fields& U,
+                        tk::Fields& R ) const override
+      { data.chbIntegral( faces, geoFace, fd, U, R ); }
       tk::real dt( const std::array< std::vector< tk::real >, 3 >& coord,
                    const std::vector< std::size_t >& inpoel,
+                   const inciter::FaceData& fd,
+                   const tk::Fields& geoFace,
+                   const tk::Fields& geoElem,
                    const tk::Fields& U ) const override
-      { return data.dt( coord, inpoel, U ); }
+      { return data.dt( coord, inpoel, fd, geoFace, geoElem, U ); }
       void side( std::unordered_set< int >& conf ) const override
       { data.side( conf ); }
       std::vector< std::string > fieldNames() const override
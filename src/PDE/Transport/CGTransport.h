@@ -75,7 +75,9 @@ class Transport {
     //! Compute the left hand side sparse matrix
     //! \param[in] coord Mesh node coordinates
     //! \param[in] inpoel Mesh element connectivity
+    //! \param[in] geoElem Element geometry, see tk::genGeoElemTetGrad()
     //! \param[in] psup Linked lists storing IDs of points surrounding points
+    //! \param[in] spidx Sparse matrix (psup1) indices of element node pairs
     //! \param[in,out] lhsd Diagonal of the sparse matrix storing nonzeros
     //! \param[in,out] lhso Off-diagonal of the sparse matrix storing nonzeros
     //! \details Sparse matrix storing the nonzero matrix values at rows and
@@ -85,11 +87,15 @@ class Transport {
     //!   at which values are nonzero, are stored by psup (psup1 and psup2,
     //!   where psup2 holds the indices at which psup1 holds the point ids
     //!   surrounding points, see also tk::genPsup()). Note that the number of
-    //!   mesh points (our chunk) npoin = psup.second.size()-1.
+    //!   mesh points (our chunk) npoin = psup.second.size()-1. The positions
+    //!   of the off-diagonal nonzeros of each element are precomputed in spidx
+    //!   (see tk::genSpidx()), so assembly is a direct scatter-add.
     void lhs( const std::array< std::vector< tk::real >, 3 >& coord,
               const std::vector< std::size_t >& inpoel,
+              const tk::Fields& geoElem,
               const std::pair< std::vector< std::size_t >,
                                std::vector< std::size_t > >& psup,
+              const std::vector< std::size_t >& spidx,
               tk::Fields& lhsd,
               tk::Fields& lhso ) const
     {
@@ -99,20 +105,13 @@ class Transport {
               "diagonal sparse matrix storage incorrect" );
       Assert( lhso.nunk() == psup.first.size(), "Number of unknowns in "
               "off-diagonal sparse matrix storage incorrect" );
-
-      // Lambda to compute the sparse matrix vector index for row and column
-      // indices. Used only for off-diagonal entries.
-      auto spidx = [ &psup ]( std::size_t r, std::size_t c ) -> std::size_t {
-        Assert( r != c, "Only for computing the off-diagonal indices" );
-        for (auto i=psup.second[r]+1; i<=psup.second[r+1]; ++i)
-          if (c == psup.first[i]) return i;
-        Throw( "Cannot find row, column: " + std::to_string(r) + ',' +
-               std::to_string(c) + " in sparse matrix" );
-      };
-
-      const auto& x = coord[0];
-      const auto& y = coord[1];
-      const auto& z = coord[2];
+      Assert( spidx.size() == inpoel.size()*3, "Size of sparse matrix index "
+              "map incorrect" );
+      Assert( geoElem.nunk() == inpoel.size()/4, "Number of elements in "
+              "element geometry incorrect" );
+      // coord and psup only used in asserts, optimized away in RELEASE mode
+      IGNORE(coord);
+      IGNORE(psup);
 
       // Zero matrix for all components
       for (ncomp_t c=0; c<m_ncomp; ++c) {
@@ -125,11 +124,9 @@ class Transport {
         const auto B = inpoel[e*4+1];
         const auto C = inpoel[e*4+2];
         const auto D = inpoel[e*4+3];
-        std::array< tk::real, 3 > ba{{ x[B]-x[A], y[B]-y[A], z[B]-z[A] }},
-                                  ca{{ x[C]-x[A], y[C]-y[A], z[C]-z[A] }},
-                                  da{{ x[D]-x[A], y[D]-y[A], z[D]-z[A] }};
-        const auto J = tk::triple( ba, ca, da ) / 120.0;
-        Assert( J > 0, "Element Jacobian non-positive" );
+        const auto J = geoElem(e,0,0) / 120.0;
+        // off-diagonal nonzero positions: AB,AC,AD,BA,BC,BD,CA,CB,CD,DA,DB,DC
+        const auto k = &spidx[ e*12 ];
 
         for (ncomp_t c=0; c<m_ncomp; ++c) {
           const auto r = lhsd.cptr( c, m_offset );
@@ -139,21 +136,7 @@ class Transport {
           lhsd.var( r, D ) += 2.0 * J;
 
           const auto s = lhso.cptr( c, m_offset );
-          lhso.var( s, spidx(A,B) ) += J;
-          lhso.var( s, spidx(A,C) ) += J;
-          lhso.var( s, spidx(A,D) ) += J;
-
-          lhso.var( s, spidx(B,A) ) += J;
-          lhso.var( s, spidx(B,C) ) += J;
-          lhso.var( s, spidx(B,D) ) += J;
-
-          lhso.var( s, spidx(C,A) ) += J;
-          lhso.var( s, spidx(C,B) ) += J;
-          lhso.var( s, spidx(C,D) ) += J;
-
-          lhso.var( s, spidx(D,A) ) += J;
-          lhso.var( s, spidx(D,B) ) += J;
-          lhso.var( s, spidx(D,C) ) += J;
+          for (std::size_t i=0; i<12; ++i) lhso.var( s, k[i] ) += J;
         }
       }
     }
@@ -162,12 +145,16 @@ class Transport {
     //! \param[in] deltat Size of time step
     //! \param[in] coord Mesh node coordinates
     //! \param[in] inpoel Mesh element connectivity
+    //! \param[in] geoElem Element geometry, see tk::genGeoElemTetGrad()
     //! \param[in] U Solution vector at recent time step
+    //! \param[in,out] Ue Element-centered solution at the half step, only
+    //!   used (and only sized) if the rhs is not fused, see kw::fused_rhs
     //! \param[in,out] R Right-hand side vector computed
     void rhs( tk::real,
               tk::real deltat,
               const std::array< std::vector< tk::real >, 3 >& coord,
               const std::vector< std::size_t >& inpoel,
+              const tk::Fields& geoElem,
               const tk::Fields& U,
               tk::Fields& Ue,
               tk::Fields& R ) const
@@ -182,115 +169,61 @@ class Transport {
               "must equal " + std::to_string(m_ncomp) );
       Assert( R.nprop() == m_ncomp, "Number of components in rhs must equal " +
               std::to_string(m_ncomp) );
+      Assert( geoElem.nunk() == inpoel.size()/4, "Number of elements in "
+              "element geometry incorrect" );
 
       const auto& x = coord[0];
       const auto& y = coord[1];
       const auto& z = coord[2];
 
-      // 1st stage: update element values from node values (gather-add)
-      for (std::size_t e=0; e<inpoel.size()/4; ++e) {
-
-        // access node IDs
-        const std::array< std::size_t, 4 > N{{ inpoel[e*4+0], inpoel[e*4+1],
-                                               inpoel[e*4+2], inpoel[e*4+3] }};
-        // compute element Jacobi determinant
-        const std::array< tk::real, 3 >
-          ba{{ x[N[1]]-x[N[0]], y[N[1]]-y[N[0]], z[N[1]]-z[N[0]] }},
-          ca{{ x[N[2]]-x[N[0]], y[N[2]]-y[N[0]], z[N[2]]-z[N[0]] }},
-          da{{ x[N[3]]-x[N[0]], y[N[3]]-y[N[0]], z[N[3]]-z[N[0]] }};
-        const auto J = tk::triple( ba, ca, da );        // J = 6V
-        Assert( J > 0, "Element Jacobian non-positive" );
-
-        // shape function derivatives, nnode*ndim [4][3]
-        std::array< std::array< tk::real, 3 >, 4 > grad;
-        grad[1] = tk::crossdiv( ca, da, J );
-        grad[2] = tk::crossdiv( da, ba, J );
-        grad[3] = tk::crossdiv( ba, ca, J );
-        for (std::size_t i=0; i<3; ++i)
-          grad[0][i] = -grad[1][i]-grad[2][i]-grad[3][i];
-
-        // access solution at element nodes
-        std::vector< std::array< tk::real, 4 > > u( m_ncomp );
-        for (ncomp_t c=0; c<m_ncomp; ++c) u[c] = U.extract( c, m_offset, N );
-        // access solution at elements
-        std::vector< const tk::real* > ue( m_ncomp );
-        for (ncomp_t c=0; c<m_ncomp; ++c) ue[c] = Ue.cptr( c, m_offset );
-
-        // sum nodal averages to element
-        for (ncomp_t c=0; c<m_ncomp; ++c) {
-          Ue.var(ue[c],e) = 0.0;
-          for (std::size_t a=0; a<4; ++a)
-            Ue.var(ue[c],e) += u[c][a]/4.0;
-        }
-
-        // get prescribed velocity
-        const std::array< std::vector<std::array<tk::real,3>>, 4 > vel{{
-         Problem::prescribedVelocity(x[N[0]], y[N[0]], z[N[0]], m_c, m_ncomp),
-         Problem::prescribedVelocity(x[N[0]], y[N[1]], z[N[1]], m_c, m_ncomp),
-         Problem::prescribedVelocity(x[N[0]], y[N[2]], z[N[2]], m_c, m_ncomp),
-         Problem::prescribedVelocity(x[N[0]], y[N[3]], z[N[3]], m_c, m_ncomp)}};
-
-        // sum flux (advection) contributions to element
-        tk::real d = deltat/2.0;
-        for (std::size_t c=0; c<m_ncomp; ++c)
-          for (std::size_t j=0; j<3; ++j)
-            for (std::size_t a=0; a<4; ++a)
-              Ue.var(ue[c],e) -= d * grad[a][j] * vel[a][c][j]*u[c][a];
-
-      }
-
+      // access pointer to right hand side at component and offset
+      std::vector< const tk::real* > r( m_ncomp );
+      for (ncomp_t c=0; c<m_ncomp; ++c) r[c] = R.cptr( c, m_offset );
 
       // zero right hand side for all components
       for (ncomp_t c=0; c<m_ncomp; ++c) R.fill( c, m_offset, 0.0 );
 
-      // 2nd stage: form rhs from element values (scatter-add)
-      for (std::size_t e=0; e<inpoel.size()/4; ++e) {
+      // solution at nodes of and at element, reused across elements
+      std::vector< std::array< tk::real, 4 > > u( m_ncomp );
+      std::vector< tk::real > ue( m_ncomp );
+
+      if (g_inputdeck.get< tag::discr, tag::fusedrhs >()) {
+
+        // compute both stages in a single pass over the elements, keeping the
+        // element-centered half-step solution in local storage
+        for (std::size_t e=0; e<inpoel.size()/4; ++e) {
+          const std::array< std::size_t, 4 >
+            N{{ inpoel[e*4+0], inpoel[e*4+1], inpoel[e*4+2], inpoel[e*4+3] }};
+          const auto grad = elemGrad( geoElem, e );
+          for (ncomp_t c=0; c<m_ncomp; ++c) u[c] = U.extract( c, m_offset, N );
+          halfstep( deltat, x, y, z, N, grad, u, ue );
+          scatter( deltat, e, N, grad, geoElem, u, ue, r, R );
+        }
 
-        // access node IDs
-        const std::array< std::size_t, 4 > N{{ inpoel[e*4+0], inpoel[e*4+1],
-                                               inpoel[e*4+2], inpoel[e*4+3] }};
-        // compute element Jacobi determinant
-        const std::array< tk::real, 3 >
-          ba{{ x[N[1]]-x[N[0]], y[N[1]]-y[N[0]], z[N[1]]-z[N[0]] }},
-          ca{{ x[N[2]]-x[N[0]], y[N[2]]-y[N[0]], z[N[2]]-z[N[0]] }},
-          da{{ x[N[3]]-x[N[0]], y[N[3]]-y[N[0]], z[N[3]]-z[N[0]] }};
-        const auto J = tk::triple( ba, ca, da );        // J = 6V
-        Assert( J > 0, "Element Jacobian non-positive" );
-
-        // shape function derivatives, nnode*ndim [4][3]
-        std::array< std::array< tk::real, 3 >, 4 > grad;
-        grad[1] = tk::crossdiv( ca, da, J );
-        grad[2] = tk::crossdiv( da, ba, J );
-        grad[3] = tk::crossdiv( ba, ca, J );
-        for (std::size_t i=0; i<3; ++i)
-          grad[0][i] = -grad[1][i]-grad[2][i]-grad[3][i];
-
-        // access solution at elements
-        std::vector< tk::real > ue( m_ncomp );
-        for (ncomp_t c=0; c<m_ncomp; ++c) ue[c] = Ue( e, c, m_offset );
-        // access pointer to right hand side at component and offset
-        std::vector< const tk::real* > r( m_ncomp );
-        for (ncomp_t c=0; c<m_ncomp; ++c) r[c] = R.cptr( c, m_offset );
-        // access solution at nodes of element
-        std::vector< std::array< tk::real, 4 > > u( m_ncomp );
-        for (ncomp_t c=0; c<m_ncomp; ++c) u[c] = U.extract( c, m_offset, N );
+      } else {
 
-        // get prescribed velocity
-        auto xc = (x[N[0]] + x[N[1]] + x[N[2]] + x[N[3]]) / 4.0;
-        auto yc = (y[N[0]] + y[N[1]] + y[N[2]] + y[N[3]]) / 4.0;
-        auto zc = (z[N[0]] + z[N[1]] + z[N[2]] + z[N[3]]) / 4.0;
-        const auto vel =
-          Problem::prescribedVelocity( xc, yc, zc, m_c, m_ncomp );
+        Assert( Ue.nunk() == inpoel.size()/4, "Number of elements in element "
+                "solution vector incorrect" );
 
-        // scatter-add flux contributions to rhs at nodes
-        tk::real d = deltat * J/6.0;
-        for (std::size_t c=0; c<m_ncomp; ++c)
-          for (std::size_t j=0; j<3; ++j)
-            for (std::size_t a=0; a<4; ++a)
-              R.var(r[c],N[a]) += d * grad[a][j] * vel[c][j]*ue[c];
+        // 1st stage: update element values from node values (gather-add)
+        for (std::size_t e=0; e<inpoel.size()/4; ++e) {
+          const std::array< std::size_t, 4 >
+            N{{ inpoel[e*4+0], inpoel[e*4+1], inpoel[e*4+2], inpoel[e*4+3] }};
+          const auto grad = elemGrad( geoElem, e );
+          for (ncomp_t c=0; c<m_ncomp; ++c) u[c] = U.extract( c, m_offset, N );
+          halfstep( deltat, x, y, z, N, grad, u, ue );
+          for (ncomp_t c=0; c<m_ncomp; ++c) Ue( e, c, m_offset ) = ue[c];
+        }
 
-        // add (optional) diffusion contribution to right hand side
-        Physics::diffusionRhs( m_c, m_ncomp, deltat, J, grad, N, u, r, R );
+        // 2nd stage: form rhs from element values (scatter-add)
+        for (std::size_t e=0; e<inpoel.size()/4; ++e) {
+          const std::array< std::size_t, 4 >
+            N{{ inpoel[e*4+0], inpoel[e*4+1], inpoel[e*4+2], inpoel[e*4+3] }};
+          const auto grad = elemGrad( geoElem, e );
+          for (ncomp_t c=0; c<m_ncomp; ++c) u[c] = U.extract( c, m_offset, N );
+          for (ncomp_t c=0; c<m_ncomp; ++c) ue[c] = Ue( e, c, m_offset );
+          scatter( deltat, e, N, grad, geoElem, u, ue, r, R );
+        }
 
       }
     }
@@ -299,14 +232,18 @@ class Transport {
     //! \param[in] U Solution vector at recent time step
     //! \param[in] coord Mesh node coordinates
     //! \param[in] inpoel Mesh element connectivity
+    //! \param[in] geoElem Element geometry, see tk::genGeoElemTetGrad()
     //! \return Minimum time step size
     tk::real dt( const std::array< std::vector< tk::real >, 3 >& coord,
                  const std::vector< std::size_t >& inpoel,
+                 const tk::Fields& geoElem,
                  const tk::Fields& U ) const
     {
       using tag::transport;
       Assert( U.nunk() == coord[0].size(), "Number of unknowns in solution "
               "vector at recent time step incorrect" );
+      Assert( geoElem.nunk() == inpoel.size()/4, "Number of elements in "
+              "element geometry incorrect" );
       const auto& x = coord[0];
       const auto& y = coord[1];
       const auto& z = coord[2];
@@ -316,11 +253,7 @@ class Transport {
         const std::array< std::size_t, 4 > N{{ inpoel[e*4+0], inpoel[e*4+1],
                                                inpoel[e*4+2], inpoel[e*4+3] }};
         // compute cubic root of element volume as the characteristic length
-        const std::array< tk::real, 3 >
-          ba{{ x[N[1]]-x[N[0]], y[N[1]]-y[N[0]], z[N[1]]-z[N[0]] }},
-          ca{{ x[N[2]]-x[N[0]], y[N[2]]-y[N[0]], z[N[2]]-z[N[0]] }},
-          da{{ x[N[3]]-x[N[0]], y[N[3]]-y[N[0]], z[N[3]]-z[N[0]] }};
-        const auto L = std::cbrt( tk::triple( ba, ca, da ) / 6.0 );
+        const auto L = std::cbrt( geoElem(e,0,0) / 6.0 );
         // access solution at element nodes at recent time step
         std::vector< std::array< tk::real, 4 > > u( m_ncomp );
         for (ncomp_t c=0; c<m_ncomp; ++c) u[c] = U.extract( c, m_offset, N );
@@ -474,6 +407,98 @@ class Transport {
     const ncomp_t m_c;                  //!< Equation system index
     const ncomp_t m_ncomp;              //!< Number of components in this PDE
     const ncomp_t m_offset;             //!< Offset this PDE operates from
+
+    //! Extract shape function derivatives of an element
+    //! \param[in] geoElem Element geometry, see tk::genGeoElemTetGrad()
+    //! \param[in] e Element ID
+    //! \return Shape function derivatives, nnode*ndim [4][3]
+    static std::array< std::array< tk::real, 3 >, 4 >
+    elemGrad( const tk::Fields& geoElem, std::size_t e ) {
+      std::array< std::array< tk::real, 3 >, 4 > grad;
+      for (std::size_t a=0; a<4; ++a)
+        for (std::size_t i=0; i<3; ++i)
+          grad[a][i] = geoElem(e,1+a*3+i,0);
+      return grad;
+    }
+
+    //! Compute element-centered half-step solution (1st Lax-Wendroff stage)
+    //! \param[in] deltat Size of time step
+    //! \param[in] x Mesh node x coordinates
+    //! \param[in] y Mesh node y coordinates
+    //! \param[in] z Mesh node z coordinates
+    //! \param[in] N Element node IDs
+    //! \param[in] grad Shape function derivatives of the element
+    //! \param[in] u Solution at element nodes for all components
+    //! \param[in,out] ue Solution at the element centroid at the half step
+    void halfstep( tk::real deltat,
+                   const std::vector< tk::real >& x,
+                   const std::vector< tk::real >& y,
+                   const std::vector< tk::real >& z,
+                   const std::array< std::size_t, 4 >& N,
+                   const std::array< std::array< tk::real, 3 >, 4 >& grad,
+                   const std::vector< std::array< tk::real, 4 > >& u,
+                   std::vector< tk::real >& ue ) const
+    {
+      // sum nodal averages to element
+      for (ncomp_t c=0; c<m_ncomp; ++c) {
+        ue[c] = 0.0;
+        for (std::size_t a=0; a<4; ++a)
+          ue[c] += u[c][a]/4.0;
+      }
+
+      // get prescribed velocity
+      const std::array< std::vector<std::array<tk::real,3>>, 4 > vel{{
+       Problem::prescribedVelocity(x[N[0]], y[N[0]], z[N[0]], m_c, m_ncomp),
+       Problem::prescribedVelocity(x[N[0]], y[N[1]], z[N[1]], m_c, m_ncomp),
+       Problem::prescribedVelocity(x[N[0]], y[N[2]], z[N[2]], m_c, m_ncomp),
+       Problem::prescribedVelocity(x[N[0]], y[N[3]], z[N[3]], m_c, m_ncomp)}};
+
+      // sum flux (advection) contributions to element
+      tk::real d = deltat/2.0;
+      for (std::size_t c=0; c<m_ncomp; ++c)
+        for (std::size_t j=0; j<3; ++j)
+          for (std::size_t a=0; a<4; ++a)
+            ue[c] -= d * grad[a][j] * vel[a][c][j]*u[c][a];
+    }
+
+    //! Scatter-add element contribution to rhs (2nd Lax-Wendroff stage)
+    //! \param[in] deltat Size of time step
+    //! \param[in] e Element ID
+    //! \param[in] N Element node IDs
+    //! \param[in] grad Shape function derivatives of the element
+    //! \param[in] geoElem Element geometry, see tk::genGeoElemTetGrad()
+    //! \param[in] u Solution at element nodes for all components
+    //! \param[in] ue Solution at the element centroid at the half step
+    //! \param[in] r Pointers to right hand side at components and offset
+    //! \param[in,out] R Right-hand side vector contributed to
+    void scatter( tk::real deltat,
+                  std::size_t e,
+                  const std::array< std::size_t, 4 >& N,
+                  const std::array< std::array< tk::real, 3 >, 4 >& grad,
+                  const tk::Fields& geoElem,
+                  const std::vector< std::array< tk::real, 4 > >& u,
+                  const std::vector< tk::real >& ue,
+                  const std::vector< const tk::real* >& r,
+                  tk::Fields& R ) const
+    {
+      // element Jacobi determinant
+      const auto J = geoElem(e,0,0);        // J = 6V
+
+      // get prescribed velocity at element centroid
+      const auto vel =
+        Problem::prescribedVelocity( geoElem(e,13,0), geoElem(e,14,0),
+                                     geoElem(e,15,0), m_c, m_ncomp );
+
+      // scatter-add flux contributions to rhs at nodes
+      tk::real d = deltat * J/6.0;
+      for (std::size_t c=0; c<m_ncomp; ++c)
+        for (std::size_t j=0; j<3; ++j)
+          for (std::size_t a=0; a<4; ++a)
+            R.var(r[c],N[a]) += d * grad[a][j] * vel[c][j]*ue[c];
+
+      // add (optional) diffusion contribution to right hand side
+      Physics::diffusionRhs( m_c, m_ncomp, deltat, J, grad, N, u, r, R );
+    }
 };
 
 } // cg::
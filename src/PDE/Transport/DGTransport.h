@@ -118,6 +118,8 @@ class Transport {
     //! \param[in] fd Face connectivity and boundary conditions object
     //! \param[in] U Solution vector at recent time step
     //! \param[in,out] R Right-hand side vector computed
+    //! \details Surface integrals on chare-boundary faces are not computed
+    //!   here as they require solution ghost data, see chbIntegral().
     void rhs( tk::real,
               const tk::Fields& geoFace,
               const tk::Fields&,
@@ -137,21 +139,10 @@ class Transport {
       // set rhs to zero
       R.fill(0.0);
 
-      // compute internal surface flux integrals
-      for (auto f=fd.Nbfac(); f<esuf.size()/2; ++f)
-      {
-        std::size_t el = static_cast< std::size_t >(esuf[2*f]);
-        std::size_t er = static_cast< std::size_t >(esuf[2*f+1]);
-        auto farea = geoFace(f,0,0);
-
-        //--- upwind fluxes
-        auto flux = upwindFlux( f, geoFace, {{U.extract(el), U.extract(er)}} );
-
-        for (ncomp_t c=0; c<m_ncomp; ++c) {
-          R(el, c, m_offset) -= farea * flux[c];
-          R(er, c, m_offset) += farea * flux[c];
-        }
-      }
+      // compute internal surface flux integrals (excluding chare-boundary
+      // faces, whose ghost data may not yet be available, see chbIntegral())
+      for (auto f=fd.Nbfac(); f<fd.Ntfac(); ++f)
+        intSurfInt( f, esuf, geoFace, U, R );
 
       // compute boundary surface flux integrals
       bndIntegral< Extrapolate >( m_bcextrapolate, bface, esuf, geoFace, U, R );
@@ -159,16 +150,87 @@ class Transport {
       bndIntegral< Outlet >( m_bcoutlet, bface, esuf, geoFace, U, R );
     }
 
+    //! Compute surface flux integrals on chare-boundary faces
+    //! \param[in] faces Chare-boundary face IDs adjacent to ghost elements
+    //! \param[in] geoFace Face geometry array
+    //! \param[in] fd Face connectivity and boundary conditions object
+    //! \param[in] U Solution vector at recent time step (including ghosts)
+    //! \param[in,out] R Right-hand side vector to add to
+    //! \details This function adds to the right-hand side computed by rhs()
+    //!   once the solution ghost data on the chare-boundary faces are known.
+    void chbIntegral( const std::vector< std::size_t >& faces,
+                      const tk::Fields& geoFace,
+                      const inciter::FaceData& fd,
+                      const tk::Fields& U,
+                      tk::Fields& R ) const
+    {
+      const auto& esuf = fd.Esuf();
+      for (auto f : faces) {
+        Assert( f >= fd.Ntfac(), "Not a chare-boundary face" );
+        intSurfInt( f, esuf, geoFace, U, R );
+      }
+    }
+
     //! Compute the minimum time step size
-//     //! \param[in] U Solution vector at recent time step
-//     //! \param[in] coord Mesh node coordinates
-//     //! \param[in] inpoel Mesh element connectivity
+    //! \param[in] coord Mesh node coordinates
+    //! \param[in] inpoel Mesh element connectivity
+    //! \param[in] fd Face connectivity data object
+    //! \param[in] geoFace Face geometry array
+    //! \param[in] geoElem Element geometry array
+    //! \param[in] U Solution vector at recent time step
     //! \return Minimum time step size
-    tk::real dt( const std::array< std::vector< tk::real >, 3 >& /*coord*/,
-                 const std::vector< std::size_t >& /*inpoel*/,
-                 const tk::Fields& /*U*/ ) const
+    //! \details The time step size of an element is its volume divided by the
+    //!   sum, over its faces, of the face area times the largest prescribed
+    //!   velocity magnitude normal to the face across all scalar components.
+    tk::real dt( const std::array< std::vector< tk::real >, 3 >& coord,
+                 const std::vector< std::size_t >& inpoel,
+                 const inciter::FaceData& fd,
+                 const tk::Fields& geoFace,
+                 const tk::Fields& geoElem,
+                 const tk::Fields& U ) const
     {
+      IGNORE(coord);
+      IGNORE(U);
+
+      const auto& esuf = fd.Esuf();
+      const auto nelem = inpoel.size()/4;
+
+      // sum of face areas times the largest normal velocities for all elements
+      std::vector< tk::real > delt( nelem, 0.0 );
+
+      for (std::size_t f=0; f<esuf.size()/2; ++f)
+      {
+        auto farea = geoFace(f,0,0);
+        std::array< tk::real, 3 > n{{ geoFace(f,1,0),
+                                      geoFace(f,2,0),
+                                      geoFace(f,3,0) }};
+
+        // get prescribed velocity at face centroid
+        const auto vel = Problem::prescribedVelocity( geoFace(f,4,0),
+                           geoFace(f,5,0), geoFace(f,6,0), m_c, m_ncomp );
+
+        // largest normal velocity across all components
+        tk::real vn = 0.0;
+        for (ncomp_t c=0; c<m_ncomp; ++c)
+          vn = std::max( vn, std::fabs( tk::dot( vel[c], n ) ) );
+
+        // contribute to the elements on both sides that we own
+        for (std::size_t s=0; s<2; ++s) {
+          if (esuf[2*f+s] < 0) continue;
+          auto e = static_cast< std::size_t >( esuf[2*f+s] );
+          if (e < nelem) delt[e] += farea * vn;
+        }
+      }
+
       tk::real mindt = std::numeric_limits< tk::real >::max();
+
+      // compute allowable dt for all elements and find the minimum
+      for (std::size_t e=0; e<nelem; ++e)
+        if (delt[e] > 0.0) {
+          auto edt = geoElem(e,0,0) / delt[e];
+          if (edt < mindt) mindt = edt;
+        }
+
       return mindt;
     }
 
@@ -287,6 +349,31 @@ class Transport {
       }
     };
 
+    //! Compute internal surface flux integral for a single face
+    //! \param[in] f Face ID at which to compute surface integral
+    //! \param[in] esuf Elements surrounding face, see tk::genEsuf()
+    //! \param[in] geoFace Face geometry array
+    //! \param[in] U Solution vector at recent time step
+    //! \param[in,out] R Right-hand side vector computed
+    void intSurfInt( std::size_t f,
+                     const std::vector< int >& esuf,
+                     const tk::Fields& geoFace,
+                     const tk::Fields& U,
+                     tk::Fields& R ) const
+    {
+      std::size_t el = static_cast< std::size_t >(esuf[2*f]);
+      std::size_t er = static_cast< std::size_t >(esuf[2*f+1]);
+      auto farea = geoFace(f,0,0);
+
+      //--- upwind fluxes
+      auto flux = upwindFlux( f, geoFace, {{U.extract(el), U.extract(er)}} );
+
+      for (ncomp_t c=0; c<m_ncomp; ++c) {
+        R(el, c, m_offset) -= farea * flux[c];
+        R(er, c, m_offset) += farea * flux[c];
+      }
+    }
+
     //! Compute boundary surface integral for a number of faces
     //! \param[in] faces Face IDs at which to compute surface integral
     //! \param[in] esuf Elements surrounding face, see tk::genEsuf()
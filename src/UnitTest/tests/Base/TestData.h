@@ -996,8 +996,8 @@ void Data_object::test< 21 >() {
   p1.fill( 0.1 );       p2.fill( 0.3 );
   e1.fill( 0.3 );       e2.fill( 0.1 );
 
-  auto p = p1 - p2;
-  auto e = e1 - e2;
+  tk::Data< tk::UnkEqComp > p = p1 - p2;
+  tk::Data< tk::EqCompUnk > e = e1 - e2;
 
   using unittest::veceq;
 
@@ -1105,8 +1105,8 @@ void Data_object::test< 23 >() {
   p1.fill( 0.1 );       p2.fill( 0.3 );
   e1.fill( 0.3 );       e2.fill( 0.1 );
 
-  auto p = p1 + p2;
-  auto e = e1 + e2;
+  tk::Data< tk::UnkEqComp > p = p1 + p2;
+  tk::Data< tk::EqCompUnk > e = e1 + e2;
 
   using unittest::veceq;
 
@@ -1214,8 +1214,8 @@ void Data_object::test< 25 >() {
   p1.fill( 0.1 );       p2.fill( 0.3 );
   e1.fill( 0.3 );       e2.fill( 0.1 );
 
-  auto p = p1 * p2;
-  auto e = e1 * e2;
+  tk::Data< tk::UnkEqComp > p = p1 * p2;
+  tk::Data< tk::EqCompUnk > e = e1 * e2;
 
   using unittest::veceq;
 
@@ -1308,8 +1308,8 @@ void Data_object::test< 27 >() {
   p1.fill( 0.1 );
   e1.fill( 0.3 );
 
-  auto p = p1 * 0.2;
-  auto e = e1 * 0.3;
+  tk::Data< tk::UnkEqComp > p = p1 * 0.2;
+  tk::Data< tk::EqCompUnk > e = e1 * 0.3;
 
   using unittest::veceq;
 
@@ -1403,8 +1403,8 @@ void Data_object::test< 29 >() {
   p1.fill( 0.1 );       p2.fill( 0.2 );
   e1.fill( 0.3 );       e2.fill( 0.6 );
 
-  auto p = p1 / p2;
-  auto e = e1 / e2;
+  tk::Data< tk::UnkEqComp > p = p1 / p2;
+  tk::Data< tk::EqCompUnk > e = e1 / e2;
 
   using unittest::veceq;
 
@@ -1465,8 +1465,8 @@ void Data_object::test< 31 >() {
   p1.fill( 0.1 );
   e1.fill( 0.3 );
 
-  auto p = 0.2 * p1;
-  auto e = 0.3 * e1;
+  tk::Data< tk::UnkEqComp > p = 0.2 * p1;
+  tk::Data< tk::EqCompUnk > e = 0.3 * e1;
 
   using unittest::veceq;
 
@@ -1805,6 +1805,79 @@ void Data_object::test< 40 >() {
          std::vector< tk::real >{ 3.0, 4.0 }, r[0] );
 }
 
+//! Test evaluating expressions on tk::Data objects
+template<> template<>
+void Data_object::test< 41 >() {
+  set_test_name( "expression templates" );
+
+  tk::Data< tk::UnkEqComp > p1( 3, 2 ), p2( 3, 2 ), p3( 3, 2 );
+  tk::Data< tk::EqCompUnk > e1( 3, 2 ), e2( 3, 2 ), e3( 3, 2 );
+
+  p1.fill( 1.0 );       p2.fill( 0.2 );       p3.fill( 0.5 );
+  e1.fill( 1.0 );       e2.fill( 0.2 );       e3.fill( 0.5 );
+
+  using unittest::veceq;
+
+  // Compound assignment of a nested expression, u += dt * r/l
+  p1 += 2.0 * p2/p3;
+  e1 += 2.0 * e2/e3;
+
+  veceq( "<UnkEqComp>::operator+=(expr) at 0,0 incorrect",
+         std::vector< tk::real >{ 1.8, 1.8, 1.8 }, p1.extract( 0, 0 ),
+         1.0e-14 );
+  veceq( "<UnkEqComp>::operator+=(expr) at 1,0 incorrect",
+         std::vector< tk::real >{ 1.8, 1.8, 1.8 }, p1.extract( 1, 0 ),
+         1.0e-14 );
+  veceq( "<EqCompUnk>::operator+=(expr) at 0,0 incorrect",
+         std::vector< tk::real >{ 1.8, 1.8, 1.8 }, e1.extract( 0, 0 ),
+         1.0e-14 );
+  veceq( "<EqCompUnk>::operator+=(expr) at 1,0 incorrect",
+         std::vector< tk::real >{ 1.8, 1.8, 1.8 }, e1.extract( 1, 0 ),
+         1.0e-14 );
+
+  // Assignment of an expression referencing the destination
+  p1 = p1 - p2*p3;
+  e1 = e1 - e2*e3;
+
+  veceq( "<UnkEqComp>::operator=(expr) at 0,1 incorrect",
+         std::vector< tk::real >{ 1.7, 1.7, 1.7 }, p1.extract( 0, 1 ),
+         1.0e-14 );
+  veceq( "<EqCompUnk>::operator=(expr) at 0,1 incorrect",
+         std::vector< tk::real >{ 1.7, 1.7, 1.7 }, e1.extract( 0, 1 ),
+         1.0e-14 );
+
+  // Compound subtraction of an expression
+  p1 -= (p2 + p3) * 2.0;
+  e1 -= (e2 + e3) * 2.0;
+
+  veceq( "<UnkEqComp>::operator-=(expr) at 1,1 incorrect",
+         std::vector< tk::real >{ 0.3, 0.3, 0.3 }, p1.extract( 1, 1 ),
+         1.0e-14 );
+  veceq( "<EqCompUnk>::operator-=(expr) at 1,1 incorrect",
+         std::vector< tk::real >{ 0.3, 0.3, 0.3 }, e1.extract( 1, 1 ),
+         1.0e-14 );
+
+  // Construction from an expression into an empty object
+  tk::Data< tk::UnkEqComp > p( p2 + p3 );
+  tk::Data< tk::EqCompUnk > e;
+  e = e2 + e3;
+
+  ensure_equals( "nunk of <UnkEqComp> from expr incorrect", p.nunk(), 3 );
+  ensure_equals( "nprop of <UnkEqComp> from expr incorrect", p.nprop(), 2 );
+  ensure_equals( "nunk of <EqCompUnk> from expr incorrect", e.nunk(), 3 );
+  ensure_equals( "nprop of <EqCompUnk> from expr incorrect", e.nprop(), 2 );
+  veceq( "<UnkEqComp>::Data(expr) at 0,1 incorrect",
+         std::vector< tk::real >{ 0.7, 0.7, 0.7 }, p.extract( 0, 1 ),
+         1.0e-14 );
+  veceq( "<EqCompUnk>::operator=(expr) into empty at 0,1 incorrect",
+         std::vector< tk::real >{ 0.7, 0.7, 0.7 }, e.extract( 0, 1 ),
+         1.0e-14 );
+
+  // Maximum difference against an unevaluated expression
+  auto m = tk::maxdiff( p, p2 + p3 );
+  ensure_equals( "maxdiff(expr) dif incorrect", m.second, 0.0, prec );
+}
+
 } // tut::
 
 #endif // test_Data_h
@@ -1633,6 +1633,40 @@ void ExodusIIMeshReader_object::test< 7 >() {
   }
 }
 
+//! Read coordinates of an unordered subset of nodes with duplicates
+template<> template<>
+void ExodusIIMeshReader_object::test< 8 >() {
+  set_test_name( "read coordinates of a subset of nodes" );
+
+  // Read in mesh from file
+  std::string infile( REGRESSION_DIR
+                      "/meshconv/exo_output/shear_5blocks_coarse.exo" );
+  tk::ExodusIIMeshReader er( infile );
+
+  // Unordered node IDs with duplicates, neighbors, and gaps small and large
+  std::vector< std::size_t > gid{ 97, 3, 4, 5, 250, 0, 98, 3, 180, 66, 1, 249 };
+
+  auto coord = er.readNodes( gid );
+
+  ensure_equals( "number of x coordinates incorrect",
+                 coord[0].size(), gid.size() );
+  ensure_equals( "number of y coordinates incorrect",
+                 coord[1].size(), gid.size() );
+  ensure_equals( "number of z coordinates incorrect",
+                 coord[2].size(), gid.size() );
+
+  tk::real prec = 1.0e-10;
+  for (std::size_t i=0; i<gid.size(); ++i) {
+    auto g = gid[i];
+    ensure_equals( "x coordinate of node " + std::to_string(g) + " incorrect",
+                   coord[0][i], shear_5blocks_coordx[g], prec );
+    ensure_equals( "y coordinate of node " + std::to_string(g) + " incorrect",
+                   coord[1][i], shear_5blocks_coordy[g], prec );
+    ensure_equals( "z coordinate of node " + std::to_string(g) + " incorrect",
+                   coord[2][i], shear_5blocks_coordz[g], prec );
+  }
+}
+
 } // tut::
 
 #endif // test_ExodusIIMeshReader_h
@@ -9,8 +9,11 @@
 #ifndef test_Mesh_h
 #define test_Mesh_h
 
+#include <map>
+
 #include "NoWarning/tut.h"
 
+#include "QuinoaConfig.h"
 #include "MeshFactory.h"
 #include "Reorder.h"
 #include "DerivedData.h"
@@ -21,6 +24,8 @@
 #include "ExodusIIMeshReader.h"
 #include "NetgenMeshWriter.h"
 #include "NetgenMeshReader.h"
+#include "NativeMeshWriter.h"
+#include "NativeMeshReader.h"
 
 namespace tut {
 
@@ -116,6 +121,11 @@ struct Mesh_common {
       tk::ExodusIIMeshWriter( filename, tk::ExoWriter::CREATE ).
         writeMesh( outmesh );
 
+    } else if (reader == tk::MeshReader::NATIVE) {
+
+      filename = "out.qmesh";
+      tk::NativeMeshWriter( filename ).writeMesh( outmesh );
+
     }
 
     // Create unstructured-mesh object to read into
@@ -138,6 +148,10 @@ struct Mesh_common {
 
       tk::ExodusIIMeshReader( filename ).readMesh( inmesh );
 
+    } else if (reader == tk::MeshReader::NATIVE) {
+
+      tk::NativeMeshReader( filename ).readMesh( inmesh );
+
     }
 
     // Test if mesh extents are the same as was written out
@@ -208,6 +222,75 @@ void Mesh_object::test< 4 >() {
   testPureTetMesh( tk::MeshReader::NETGEN );
 }
 
+//! Write and read native binary mesh
+template<> template<>
+void Mesh_object::test< 5 >() {
+  set_test_name( "write/read native binary tet-mesh" );
+  testPureTetMesh( tk::MeshReader::NATIVE );
+}
+
+//! Write native binary mesh with side sets and derived data and read parts
+template<> template<>
+void Mesh_object::test< 6 >() {
+  set_test_name( "native binary mesh partial reads" );
+
+  // Read mesh with side sets from ExodusII file
+  tk::UnsMesh mesh;
+  tk::ExodusIIMeshReader er( REGRESSION_DIR
+                             "/meshconv/gmsh_output/box_24_ss1.exo" );
+  er.readMesh( mesh );
+  er.readSidesets( mesh );
+  ensure( "no side sets read", !mesh.bnode().empty() );
+
+  // Write out in native format with derived data, detect, and map file back
+  std::string filename( "out_partial.qmesh" );
+  tk::NativeMeshWriter( filename ).writeMesh( mesh, true );
+  ensure( "native mesh not detected",
+          tk::detectInput( filename ) == tk::MeshReader::NATIVE );
+
+  {
+    tk::NativeMeshReader nr( filename );
+
+    ensure_equals( "number of nodes incorrect", nr.nnode(), mesh.nnode() );
+    ensure_equals( "number of tetrahedra incorrect",
+                   nr.ntet(), mesh.tetinpoel().size()/4 );
+
+    // Read a chunk of tetrahedra
+    std::vector< std::size_t > conn;
+    nr.readElements( 2, 5, conn );
+    const auto& inpoel = mesh.tetinpoel();
+    ensure( "chunk of element connectivity incorrect",
+            conn == std::vector< std::size_t >( inpoel.begin()+2*4,
+                                                inpoel.begin()+5*4 ) );
+
+    // Read coordinates of a few nodes
+    std::vector< std::size_t > gid{ 7, 0, 3, 7 };
+    auto coord = nr.readNodes( gid );
+    for (std::size_t i=0; i<gid.size(); ++i) {
+      ensure_equals( "x coordinate incorrect", coord[0][i], mesh.x()[gid[i]] );
+      ensure_equals( "y coordinate incorrect", coord[1][i], mesh.y()[gid[i]] );
+      ensure_equals( "z coordinate incorrect", coord[2][i], mesh.z()[gid[i]] );
+    }
+
+    // Read side sets
+    ensure( "side set node lists incorrect",
+            nr.readSidesets() == mesh.bnode() );
+    std::map< int, std::vector< std::size_t > > bface;
+    nr.readSidesetFaces( bface );
+    ensure( "side set face lists incorrect", bface == mesh.bface() );
+
+    // Read derived data
+    ensure( "derived data not found", nr.derived() );
+    const auto esup = tk::genEsup( mesh.tetinpoel(), 4 );
+    ensure( "esup incorrect", nr.readEsup() == esup );
+    ensure( "psup incorrect",
+            nr.readPsup() == tk::genPsup( mesh.tetinpoel(), 4, esup ) );
+  }
+
+  // remove mesh file from disk
+  tk::rm( filename );
+}
+
 } // tut::
 
 #endif // test_Mesh_h
@@ -0,0 +1,124 @@
+// *****************************************************************************
+/*!
+  \file      src/UnitTest/tests/Inciter/TestRungeKutta.h
+  \copyright 2016-2018, Los Alamos National Security, LLC.
+  \brief     Unit tests for Inciter/RungeKutta.h
+  \details   Unit tests for Inciter/RungeKutta.h. The coefficients are tested
+    by applying the schemes, in the same Shu-Osher form as DG and DiagCG do,
+    to scalar ordinary differential equations whose solutions are integrated
+    exactly (up to round-off) by a scheme of the given order.
+*/
+// *****************************************************************************
+#ifndef test_RungeKutta_h
+#define test_RungeKutta_h
+
+#include <cmath>
+#include <limits>
+#include <functional>
+
+#include "NoWarning/tut.h"
+
+#include "RungeKutta.h"
+
+namespace tut {
+
+//! All tests in group inherited from this base
+struct RungeKutta_common {
+  //! Advance a scalar ODE du/dt = L(u,t) by a single time step
+  //! \param[in] nstage Number of stages of the scheme
+  //! \param[in] un Solution at the beginning of the time step
+  //! \param[in] t Physical time at the beginning of the time step
+  //! \param[in] dt Time step size
+  //! \param[in] L Right hand side of the ODE
+  //! \return Solution at the end of the time step
+  tk::real step( std::size_t nstage,
+                 tk::real un,
+                 tk::real t,
+                 tk::real dt,
+                 const std::function< tk::real(tk::real,tk::real) >& L )
+  {
+    const auto& a = inciter::rkcoef_a[ nstage-1 ];
+    const auto& b = inciter::rkcoef_b[ nstage-1 ];
+    const auto& c = inciter::rkcoef_c[ nstage-1 ];
+    auto u = un;
+    for (std::size_t s=0; s<nstage; ++s)
+      u = a[s]*un + b[s]*( u + dt*L( u, t + c[s]*dt ) );
+    return u;
+  }
+};
+
+//! Test group shortcuts
+using RungeKutta_group =
+  test_group< RungeKutta_common, MAX_TESTS_IN_GROUP >;
+using RungeKutta_object = RungeKutta_group::object;
+
+//! Define test group
+static RungeKutta_group RungeKutta( "Inciter/RungeKutta" );
+
+//! Test definitions for group
+
+//! Test if every stage is a convex combination of forward Euler steps
+template<> template<>
+void RungeKutta_object::test< 1 >() {
+  set_test_name( "stages are convex combinations" );
+
+  const tk::real prec = std::numeric_limits< tk::real >::epsilon();
+
+  for (std::size_t n=1; n<=3; ++n)
+    for (std::size_t s=0; s<n; ++s) {
+      const auto a = inciter::rkcoef_a[n-1][s];
+      const auto b = inciter::rkcoef_b[n-1][s];
+      ensure( "negative weight", a >= 0.0 && b >= 0.0 );
+      ensure_equals( "weights do not sum to one", a+b, 1.0, prec );
+    }
+}
+
+//! Test if the schemes are of order equal to their number of stages on
+//! du/dt = lambda*u
+//! \details For a linear autonomous ODE, an s-stage scheme of order s
+//!   multiplies the solution by the Taylor polynomial of exp(lambda*dt) of
+//!   degree s.
+template<> template<>
+void RungeKutta_object::test< 2 >() {
+  set_test_name( "amplification factor of linear ODE" );
+
+  const tk::real prec = 10.0 * std::numeric_limits< tk::real >::epsilon();
+  const tk::real lambda = -2.0;
+  const tk::real dt = 0.1;
+  const auto z = lambda*dt;
+
+  for (std::size_t n=1; n<=3; ++n) {
+    auto u = step( n, 1.0, 0.0, dt,
+                   [&]( tk::real v, tk::real ){ return lambda*v; } );
+    tk::real taylor = 0.0, term = 1.0;
+    for (std::size_t k=0; k<=n; ++k) {
+      taylor += term;
+      term *= z / static_cast< tk::real >( k+1 );
+    }
+    ensure_equals( "amplification factor of " + std::to_string(n) +
+                   "-stage scheme incorrect", u, taylor, prec );
+  }
+}
+
+//! Test if the stage times integrate du/dt = t^k exactly for k < number of
+//! stages
+template<> template<>
+void RungeKutta_object::test< 3 >() {
+  set_test_name( "stage times integrate polynomials" );
+
+  const tk::real prec = 10.0 * std::numeric_limits< tk::real >::epsilon();
+
+  for (std::size_t n=1; n<=3; ++n)
+    for (std::size_t k=0; k<n; ++k) {
+      const auto p = static_cast< tk::real >( k );
+      auto u = step( n, 0.0, 0.0, 1.0,
+                     [&]( tk::real, tk::real t ){ return std::pow( t, p ); } );
+      ensure_equals( "integral of t^" + std::to_string(k) + " by " +
+                     std::to_string(n) + "-stage scheme incorrect",
+                     u, 1.0/(p+1.0), prec );
+    }
+}
+
+} // tut::
+
+#endif // test_RungeKutta_h
@@ -3492,6 +3492,141 @@ void DerivedData_object::test< 70 >() {
                   geoElem(0,3,0), correct_ecent[2][0], prec);
 }
 
+//! Attempt to generate sparse matrix indices with empty connectivity
+template<> template<>
+void DerivedData_object::test< 71 >() {
+  set_test_name( "genSpidx throws with empty inpoel" );
+
+  #ifdef NDEBUG        // exception only thrown in DEBUG mode
+    skip( "in RELEASE mode, would yield segmentation fault" );
+  #else
+  try {
+    std::vector< std::size_t > inpoel { 0, 1, 2, 3 };
+    std::vector< std::size_t > empty;
+    tk::genSpidx( empty, 4, tk::genPsup( inpoel, 4, tk::genEsup(inpoel,4) ) );
+    fail( "should throw exception in DEBUG mode" );
+  }
+  catch ( tk::Exception& ) {
+    // exception thrown in DEBUG mode, test ok
+  }
+  #endif
+}
+
+//! Generate and test sparse matrix indices for tetrahedron-only mesh
+template<> template<>
+void DerivedData_object::test< 72 >() {
+  set_test_name( "genSpidx for tetrahedra" );
+
+  // mesh connectivity for simple tetrahedron-only mesh
+  std::vector< std::size_t > inpoel { 12, 14,  9, 11,
+                                      10, 14, 13, 12,
+                                      14, 13, 12,  9,
+                                      10, 14, 12, 11,
+                                      1,  14,  5, 11,
+                                      7,   6, 10, 12,
+                                      14,  8,  5, 10,
+                                      8,   7, 10, 13,
+                                      7,  13,  3, 12,
+                                      1,   4, 14,  9,
+                                      13,  4,  3,  9,
+                                      3,   2, 12,  9,
+                                      4,   8, 14, 13,
+                                      6,   5, 10, 11,
+                                      1,   2,  9, 11,
+                                      2,   6, 12, 11,
+                                      6,  10, 12, 11,
+                                      2,  12,  9, 11,
+                                      5,  14, 10, 11,
+                                      14,  8, 10, 13,
+                                      13,  3, 12,  9,
+                                      7,  10, 13, 12,
+                                      14,  4, 13,  9,
+                                      14,  1,  9, 11 };
+
+  // Shift node IDs to start from zero
+  tk::shiftToZero( inpoel );
+
+  // Generate points surrounding points and sparse matrix indices
+  auto psup = tk::genPsup( inpoel, 4, tk::genEsup(inpoel,4) );
+  auto spidx = tk::genSpidx( inpoel, 4, psup );
+
+  ensure_equals( "size of spidx incorrect", spidx.size(), inpoel.size()*3 );
+
+  // test if every index points to the column in the row of the node pair
+  for (std::size_t e=0; e<inpoel.size()/4; ++e) {
+    std::size_t k = 0;
+    for (std::size_t a=0; a<4; ++a)
+      for (std::size_t b=0; b<4; ++b) {
+        if (a == b) continue;
+        auto r = inpoel[e*4+a];
+        auto c = inpoel[e*4+b];
+        auto i = spidx[e*12+k];
+        ++k;
+        ensure( "spidx for element " + std::to_string(e) + ", row " +
+                std::to_string(r) + ", column " + std::to_string(c) +
+                " outside of row in psup",
+                i > psup.second[r] && i <= psup.second[r+1] );
+        ensure_equals( "spidx for element " + std::to_string(e) + ", row " +
+                       std::to_string(r) + " points to wrong column",
+                       psup.first[i], c );
+      }
+  }
+}
+
+//! Generate and test element-geometry with shape function derivatives
+template<> template<>
+void DerivedData_object::test< 73 >() {
+  set_test_name( "Element-geometry (genGeoElemTetGrad) for a tetrahedron" );
+
+  // coordinates of tetrahedron vertices
+  tk::UnsMesh::Coords coord {{ {1.0, 0.0, 0.0, 0.0},
+                               {0.0, 0.0, 1.0, 0.0},
+                               {0.0, 0.0, 0.0, 1.0} }};
+
+  // element-node connectivity
+  std::vector< std::size_t > inpoel { 0, 3, 2, 1 };
+
+  // get element-geometries
+  auto geoElem = tk::genGeoElemTetGrad( inpoel, coord );
+
+  ensure_equals( "incorrect number of components in geoElem",
+                 geoElem.nprop(), 16 );
+
+  // correct element Jacobian determinant: 6 x volume
+  tk::real correct_J { 1.0 };
+
+  // correct shape function derivatives: the linear shape functions of the
+  // element nodes are x, z, y, 1-x-y-z, respectively
+  std::array< std::array< tk::real, 3 >, 4 > correct_grad{{
+    {{ 1.0, 0.0, 0.0 }},
+    {{ 0.0, 0.0, 1.0 }},
+    {{ 0.0, 1.0, 0.0 }},
+    {{ -1.0, -1.0, -1.0 }} }};
+
+  // correct element-centroid
+  std::array< tk::real, 3 > correct_ecent {{ 1.0/4.0, 1.0/4.0, 1.0/4.0 }};
+
+  tk::real prec = std::numeric_limits< tk::real >::epsilon();
+
+  ensure_equals("incorrect entry in geoElem-J",
+                  geoElem(0,0,0), correct_J, prec);
+
+  for (std::size_t a=0; a<4; ++a)
+    for (std::size_t i=0; i<3; ++i)
+      ensure_equals("incorrect entry " + std::to_string(a) + ',' +
+                    std::to_string(i) + " in geoElem-grad",
+                    geoElem(0,1+a*3+i,0), correct_grad[a][i], prec);
+
+  ensure_equals("incorrect entry in geoElem-cx",
+                  geoElem(0,13,0), correct_ecent[0], prec);
+
+  ensure_equals("incorrect entry in geoElem-cy",
+                  geoElem(0,14,0), correct_ecent[1], prec);
+
+  ensure_equals("incorrect entry in geoElem-cz",
+                  geoElem(0,15,0), correct_ecent[2], prec);
+}
+
 #if defined(STRICT_GNUC)
   #pragma GCC diagnostic pop
 #endif
@@ -112,10 +112,15 @@
 #ifndef test_Reorder_h
 #define test_Reorder_h
 
+#include <array>
+#include <numeric>
+#include <algorithm>
+
 #include "NoWarning/tut.h"
 
 #include "Reorder.h"
 #include "DerivedData.h"
+#include "ContainerUtil.h"
 
 namespace tut {
 
@@ -387,6 +392,135 @@ void Reorder_object::test< 6 >() {
           inpoel == correct_renumbered_inpoel );
 }
 
+//! Renumber tetrahedron mesh with reverse Cuthill-McKee
+template<> template<>
+void Reorder_object::test< 7 >() {
+  set_test_name( "renumberRCM tetrahedron mesh" );
+
+  // Mesh connectivity for simple tetrahedron-only mesh
+  std::vector< std::size_t > inpoel { 12, 14,  9, 11,
+                                      10, 14, 13, 12,
+                                      14, 13, 12,  9,
+                                      10, 14, 12, 11,
+                                      1,  14,  5, 11,
+                                      7,   6, 10, 12,
+                                      14,  8,  5, 10,
+                                      8,   7, 10, 13,
+                                      7,  13,  3, 12,
+                                      1,   4, 14,  9,
+                                      13,  4,  3,  9,
+                                      3,   2, 12,  9,
+                                      4,   8, 14, 13,
+                                      6,   5, 10, 11,
+                                      1,   2,  9, 11,
+                                      2,   6, 12, 11,
+                                      6,  10, 12, 11,
+                                      2,  12,  9, 11,
+                                      5,  14, 10, 11,
+                                      14,  8, 10, 13,
+                                      13,  3, 12,  9,
+                                      7,  10, 13, 12,
+                                      14,  4, 13,  9,
+                                      14,  1,  9, 11 };
+
+  // Shift node IDs to start from zero
+  tk::shiftToZero( inpoel );
+
+  // Compute largest node ID difference within elements
+  auto bandwidth = []( const std::vector< std::size_t >& in ) {
+    std::size_t b = 0;
+    for (std::size_t e=0; e<in.size()/4; ++e)
+      for (std::size_t i=0; i<4; ++i)
+        for (std::size_t j=0; j<4; ++j)
+          if (in[e*4+i] > in[e*4+j]) b = std::max( b, in[e*4+i]-in[e*4+j] );
+    return b; };
+
+  // Renumber tetrahedron mesh
+  const auto psup = tk::genPsup( inpoel, 4, tk::genEsup( inpoel, 4 ) );
+  auto map = tk::renumberRCM( psup );
+
+  // Test if map is a permutation
+  auto sorted = map;
+  std::sort( begin(sorted), end(sorted) );
+  std::vector< std::size_t > correct_sorted( psup.second.size()-1 );
+  std::iota( begin(correct_sorted), end(correct_sorted), 0 );
+  ensure( "renumbering is not a permutation", sorted == correct_sorted );
+
+  // Test if renumbering reduces the bandwidth
+  auto b = bandwidth( inpoel );
+  tk::remap( inpoel, map );
+  ensure_equals( "bandwidth before renumbering incorrect", b, 13 );
+  ensure_equals( "bandwidth after renumbering incorrect",
+                 bandwidth( inpoel ), 9 );
+}
+
+//! Generate local connectivity with renumbering
+template<> template<>
+void Reorder_object::test< 8 >() {
+  set_test_name( "global2local with reordering" );
+
+  // Mesh connectivity for simple tetrahedron-only mesh
+  std::vector< std::size_t > inpoel { 12, 14,  9, 11,
+                                      10, 14, 13, 12,
+                                      14, 13, 12,  9,
+                                      10, 14, 12, 11,
+                                      1,  14,  5, 11,
+                                      7,   6, 10, 12,
+                                      14,  8,  5, 10,
+                                      8,   7, 10, 13,
+                                      7,  13,  3, 12,
+                                      1,   4, 14,  9,
+                                      13,  4,  3,  9,
+                                      3,   2, 12,  9,
+                                      4,   8, 14, 13,
+                                      6,   5, 10, 11,
+                                      1,   2,  9, 11,
+                                      2,   6, 12, 11,
+                                      6,  10, 12, 11,
+                                      2,  12,  9, 11,
+                                      5,  14, 10, 11,
+                                      14,  8, 10, 13,
+                                      13,  3, 12,  9,
+                                      7,  10, 13, 12,
+                                      14,  4, 13,  9,
+                                      14,  1,  9, 11 };
+
+  auto el = tk::global2local( inpoel, true );
+  const auto& linpoel = std::get< 0 >( el );
+  const auto& gid = std::get< 1 >( el );
+  const auto& lid = std::get< 2 >( el );
+
+  ensure_equals( "size of connectivity incorrect",
+                 linpoel.size(), inpoel.size() );
+  ensure_equals( "number of global IDs incorrect", gid.size(), 14 );
+
+  // Test if global->local and local->global maps are consistent
+  for (std::size_t i=0; i<gid.size(); ++i)
+    ensure_equals( "global->local map inconsistent for global ID " +
+                   std::to_string(gid[i]), tk::cref_find(lid,gid[i]), i );
+
+  // Test if the same elements, with the same node order, are present
+  std::vector< std::array< std::size_t, 4 > > orig, reordered;
+  for (std::size_t e=0; e<inpoel.size()/4; ++e) {
+    orig.push_back( {{ inpoel[e*4+0], inpoel[e*4+1],
+                       inpoel[e*4+2], inpoel[e*4+3] }} );
+    reordered.push_back( {{ gid[linpoel[e*4+0]], gid[linpoel[e*4+1]],
+                            gid[linpoel[e*4+2]], gid[linpoel[e*4+3]] }} );
+  }
+  std::sort( begin(orig), end(orig) );
+  std::sort( begin(reordered), end(reordered) );
+  ensure( "reordered elements incorrect", orig == reordered );
+
+  // Test if elements are in ascending order of their lowest node ID
+  std::size_t low = 0;
+  for (std::size_t e=0; e<linpoel.size()/4; ++e) {
+    auto l = *std::min_element( begin(linpoel) + static_cast<long>(e*4),
+                                begin(linpoel) + static_cast<long>(e*4+4) );
+    ensure( "elements not ordered by lowest node ID", l >= low );
+    low = l;
+  }
+}
+
 } // tut::
 
 #endif // test_Reorder_h
@@ -0,0 +1,125 @@
+// *****************************************************************************
+/*!
+  \file      src/UnitTest/tests/PDE/TestRiemann.h
+  \copyright 2016-2018, Los Alamos National Security, LLC.
+  \brief     Unit tests for PDE/CompFlow/Riemann
+  \details   Unit tests for PDE/CompFlow/Riemann. The fluxes computed by the
+    Riemann solvers for a block of faces, a SIMD pack at a time, are compared
+    bitwise to those computed by the scalar instantiation of the same kernels,
+    a single face at a time.
+*/
+// *****************************************************************************
+#ifndef test_Riemann_h
+#define test_Riemann_h
+
+#include <cmath>
+#include <cstring>
+#include <random>
+#include <string>
+
+#include "NoWarning/tut.h"
+
+#include "Inciter/InputDeck/InputDeck.h"
+
+namespace inciter {
+
+extern ctr::InputDeck g_inputdeck;
+
+} // inciter::
+
+#include "CompFlow/Riemann/HLLC.h"
+#include "CompFlow/Riemann/LaxFriedrichs.h"
+
+namespace tut {
+
+//! All tests in group inherited from this base
+struct Riemann_common {
+  //! Generate a block of faces with random unit normals and states
+  //! \param[in] g Ratio of specific heats
+  //! \param[in] size Number of faces in the block
+  //! \param[in] gen Random number generator
+  //! \return Block of faces with physically admissible left and right states
+  inciter::FaceBlock block( tk::real g, std::size_t size, std::mt19937& gen )
+  const {
+    std::uniform_real_distribution< tk::real > d( -1.0, 1.0 );
+    inciter::FaceBlock b;
+    b.size = size;
+    for (std::size_t i=0; i<size; ++i) {
+      std::array< tk::real, 3 > n{{ d(gen), d(gen), d(gen) }};
+      auto l = std::sqrt( n[0]*n[0] + n[1]*n[1] + n[2]*n[2] );
+      for (std::size_t j=0; j<3; ++j) b.fn[j][i] = n[j]/l;
+      for (std::size_t s=0; s<2; ++s) {
+        auto r = 1.0 + 0.9*d(gen);
+        auto p = 1.0 + 0.9*d(gen);
+        std::array< tk::real, 3 > v{{ 2.0*d(gen), 2.0*d(gen), 2.0*d(gen) }};
+        b.u[s][0][i] = r;
+        for (std::size_t j=0; j<3; ++j) b.u[s][j+1][i] = r*v[j];
+        b.u[s][4][i] = p/(g-1.0) + 0.5*r*(v[0]*v[0] + v[1]*v[1] + v[2]*v[2]);
+      }
+    }
+    return b;
+  }
+
+  //! Test if the block flux is bitwise identical to the scalar flux
+  //! \param[in] solver Riemann solver name to use in failure messages
+  //! \param[in] blockflux Function computing the fluxes of a block
+  //! \param[in] faceflux Function computing the flux of a single face
+  template< class Block, class Face >
+  void compare( const std::string& solver, Block blockflux, Face faceflux )
+  const {
+    const tk::real g = 1.4;
+    std::mt19937 gen( 1 );
+    for (std::size_t n=0; n<1000; ++n) {
+      auto size = 1 + n % inciter::FaceBlock::N;
+      auto b = block( g, size, gen );
+      auto s = b;
+      blockflux( g, b );
+      for (std::size_t i=0; i<size; ++i) faceflux( g, s, i );
+      for (std::size_t c=0; c<5; ++c)
+        for (std::size_t i=0; i<size; ++i)
+          ensure( solver + " flux component " + std::to_string(c) +
+                  " of face " + std::to_string(i) + " of " +
+                  std::to_string(size) + " differs from scalar flux",
+                  std::memcmp( &b.flx[c][i], &s.flx[c][i],
+                               sizeof(tk::real) ) == 0 );
+    }
+  }
+};
+
+//! Test group shortcuts
+using Riemann_group = test_group< Riemann_common, MAX_TESTS_IN_GROUP >;
+using Riemann_object = Riemann_group::object;
+
+//! Define test group
+static Riemann_group Riemann( "PDE/CompFlow/Riemann" );
+
+//! Test definitions for group
+
+//! Test if the HLLC block flux is bitwise identical to the scalar flux
+template<> template<>
+void Riemann_object::test< 1 >() {
+  set_test_name( "HLLC block flux equals scalar flux" );
+
+  compare( "HLLC",
+           []( tk::real g, inciter::FaceBlock& b )
+           { inciter::HLLC::flux( g, b ); },
+           []( tk::real g, inciter::FaceBlock& b, std::size_t i )
+           { inciter::HLLC::flux< tk::real >( g, b, i ); } );
+}
+
+//! Test if the Lax-Friedrichs block flux is bitwise identical to the scalar
+//! flux
+template<> template<>
+void Riemann_object::test< 2 >() {
+  set_test_name( "Lax-Friedrichs block flux equals scalar flux" );
+
+  compare( "Lax-Friedrichs",
+           []( tk::real g, inciter::FaceBlock& b )
+           { inciter::LaxFriedrichs::flux( g, b ); },
+           []( tk::real g, inciter::FaceBlock& b, std::size_t i )
+           { inciter::LaxFriedrichs::flux< tk::real >( g, b, i ); } );
+}
+
+} // tut::
+
+#endif // test_Riemann_h